@@ -12,6 +12,9 @@
 #include <zephyr/input/input.h>
 #include <zephyr/sys/util.h>
 #include <zephyr/sys/printk.h>
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_TRACING)
+#include <zephyr/tracing/tracing.h>
+#endif
 
 
 
@@ -35,7 +38,11 @@ struct zmk_input_processor_state;
 #define MAX_SAFE_FACTOR         10000   // Maximum safe acceleration factor
 #define MAX_SAFE_SENSITIVITY    2000    // Maximum safe sensitivity (aligned with Kconfig)
 #define MIN_SAFE_SENSITIVITY    200     // Minimum safe sensitivity (aligned with Kconfig)
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_WIDE_RANGE)
+#define MAX_REASONABLE_SPEED    1000000 // Maximum reasonable speed (counts/sec, wide range)
+#else
 #define MAX_REASONABLE_SPEED    50000   // Maximum reasonable speed (counts/sec)
+#endif
 
 // Input validation constants
 #define MAX_REASONABLE_INPUT    200     // Maximum reasonable input for normal use
@@ -50,7 +57,11 @@ struct zmk_input_processor_state;
 #define CURVE_TYPE_MIN          0       // Minimum curve type
 #define CURVE_TYPE_MAX          2       // Maximum curve type
 #define SENSOR_DPI_MIN          400     // Minimum sensor DPI
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_WIDE_RANGE)
+#define SENSOR_DPI_MAX          32000   // Maximum sensor DPI (wide range, pre-scaled)
+#else
 #define SENSOR_DPI_MAX          8000    // Maximum sensor DPI
+#endif
 #define SPEED_THRESHOLD_MIN     100     // Minimum speed threshold
 #define SPEED_THRESHOLD_MAX     2000    // Maximum speed threshold
 #define SPEED_MAX_MIN           1000    // Minimum speed max
@@ -90,10 +101,9 @@ struct zmk_input_processor_state;
 #define QUADRATIC_SAFE_INPUT_LIMIT  1000    // Safe input limit for quadratic calculations
 #define QUADRATIC_LINEAR_DIVISOR    10      // Divisor for linear approximation
 #define QUADRATIC_SCALE_DIVISOR     100     // Scale divisor for quadratic results
-#define LOG_COUNTER_INTERVAL        200     // Interval for debug logging
 
-// Memory pool alignment
-#define ACCEL_DATA_POOL_ALIGNMENT   4       // Memory pool alignment in bytes
+// Context slab alignment
+#define ACCEL_DATA_POOL_ALIGNMENT   4       // Minimum slab block alignment in bytes
 
 // Default values
 #define DEFAULT_SPEED_THRESHOLD     600     // Default speed threshold
@@ -101,7 +111,38 @@ struct zmk_input_processor_state;
 
 // DPI calculation constants
 #define STANDARD_DPI_REFERENCE  800     // Reference DPI for normalization
-#define MAX_SENSOR_DPI          8000    // Maximum supported sensor DPI
+#define MAX_SENSOR_DPI          SENSOR_DPI_MAX // Maximum supported sensor DPI
+#define ACCEL_DPI_SCALE_SHIFT   16      // Q16 fixed-point DPI scale
+#define ACCEL_DPI_SCALE_ONE     (1UL << ACCEL_DPI_SCALE_SHIFT) // 1.0 (sensor at reference DPI)
+// Rounded Q16 reciprocal STANDARD_DPI_REFERENCE / dpi (constant expression for constant dpi)
+#define ACCEL_DPI_SCALE_Q16(dpi) \
+    ((((uint32_t)STANDARD_DPI_REFERENCE << ACCEL_DPI_SCALE_SHIFT) + (dpi) / 2) / (dpi))
+// DPI-adjusted sensitivity: sensitivity * scale, reduced at most to 1/4 or raised
+// at most 3x, within the safe sensitivity range (constant expression for
+// constant arguments)
+#define Z_ACCEL_DPI_SENS_RAW(sens, scale) \
+    ((uint32_t)(((uint64_t)(sens) * (scale)) >> ACCEL_DPI_SCALE_SHIFT))
+#define ACCEL_DPI_SENSITIVITY(sens, scale)                                                      \
+    ACCEL_CLAMP(((scale) < ACCEL_DPI_SCALE_ONE) ?                                                \
+                    MAX(Z_ACCEL_DPI_SENS_RAW(sens, scale), (uint32_t)(sens) / FALLBACK_MAX_REDUCTION) : \
+                ((scale) > ACCEL_DPI_SCALE_ONE) ?                                                \
+                    MIN(Z_ACCEL_DPI_SENS_RAW(sens, scale), (uint32_t)(sens) * FALLBACK_MAX_INCREASE) : \
+                    (uint32_t)(sens),                                                            \
+                (uint32_t)MIN_SAFE_SENSITIVITY, (uint32_t)MAX_SAFE_SENSITIVITY)
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_WIDE_RANGE)
+// Wide range: sensors above the non-wide DPI limit are pre-scaled to it, so
+// every DPI up to 8000 keeps the sensitivity adjustment and speed units it
+// has without the option
+#define ACCEL_PRESCALE_DPI      8000
+// Q16 ACCEL_PRESCALE_DPI / dpi, 0 when no pre-scale is needed
+#define ACCEL_PRESCALE_Q16(dpi) \
+    (((dpi) > ACCEL_PRESCALE_DPI) ? \
+     ((((uint32_t)ACCEL_PRESCALE_DPI << ACCEL_DPI_SCALE_SHIFT) + (dpi) / 2) / (dpi)) : 0)
+// DPI the sensitivity adjustment sees (counts after the pre-scale)
+#define ACCEL_ADJUST_DPI(dpi)   MIN((dpi), ACCEL_PRESCALE_DPI)
+#else
+#define ACCEL_ADJUST_DPI(dpi)   (dpi)
+#endif
 
 // Exponential curve calculation constants
 #define CURVE_MILD_DIVISOR      2000ULL    // Divisor for mild exponential curve
@@ -121,6 +162,19 @@ struct zmk_input_processor_state;
 // Essential utility macros (optimized for MCU)
 #define ACCEL_CLAMP(val, min, max) ((val) < (min) ? (min) : ((val) > (max) ? (max) : (val)))
 
+/**
+ * @brief Guard for a condition validated configurations never reach
+ * The checked build handles it at runtime. With
+ * CONFIG_INPUT_PROCESSOR_ACCEL_FAST_PATH it becomes an assertion and the
+ * handling code is compiled out; tools/host `make check-fast-path` shows
+ * both builds give the same output over the whole domain.
+ */
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_FAST_PATH)
+#define ACCEL_GUARD(cond) ({ __ASSERT_NO_MSG(!(cond)); false; })
+#else
+#define ACCEL_GUARD(cond) unlikely(cond)
+#endif
+
 
 // Error severity levels for acceleration processor
 // Level 1: Minor issues (processing continues with fallback)
@@ -150,6 +204,45 @@ struct zmk_input_processor_state;
 #define ACCEL_MAX_SPEED_SAMPLES     8       // Maximum speed samples for averaging
 #define ACCEL_SPEED_SCALE_FACTOR    10      // Speed scaling factor (simpler than 1000)
 
+// Adaptive report-rate detection constants
+#define ACCEL_RATE_WINDOW_SIZE      5       // Intervals kept for the running median
+#define ACCEL_RATE_MIN_INTERVAL_US  100     // Shorter gaps are X/Y events of the same report
+#define ACCEL_RATE_MAX_INTERVAL_US  50000   // Longer gaps are pauses, not report intervals
+#define ACCEL_RATE_REFERENCE_US     8000    // Report interval the presets are tuned for (125 Hz)
+#define ACCEL_RATE_MIN_ALPHA        20      // Lower bound for the rate-scaled EMA alpha
+
+// Burst-aware timing constants
+#define ACCEL_BURST_WINDOW_US       2000    // Reports closer than this to a burst start share it
+#define ACCEL_BURST_MAX_REPORTS     255     // Saturation limit for reports per burst
+
+// Speed state width: 32-bit in wide-range mode, 16-bit otherwise
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_WIDE_RANGE)
+typedef uint32_t accel_speed_t;
+typedef uint64_t accel_speed_acc_t;     // EMA accumulator
+#define ACCEL_SPEED_LIMIT           MAX_REASONABLE_SPEED
+#else
+typedef uint16_t accel_speed_t;
+typedef uint32_t accel_speed_acc_t;     // EMA accumulator
+#define ACCEL_SPEED_LIMIT           UINT16_MAX
+#endif
+
+// Overflow carry constants
+#define ACCEL_CARRY_AXES            2       // Carried axes: REL_X and REL_Y
+#define ACCEL_CARRY_EXPIRY_MS       100     // Backlog older than this is dropped
+
+// Transform matrix constants (thousandths, row-major m00 m01 m10 m11)
+#define ACCEL_TRANSFORM_SIZE        4       // 2x2 matrix entries
+#define ACCEL_TRANSFORM_MAX         4000    // Entry limit (+/-4.0)
+
+// Processing pipeline constants
+#define ACCEL_MAX_STAGES            8       // Stage slots per instance
+
+// Deferred processing constants
+
+// Latency budget constants
+#define ACCEL_BUDGET_LUT_SIZE       64      // Fast-path table entries (|input| 0..63)
+#define ACCEL_BUDGET_PROBE_INTERVAL 32      // Degraded events between full-path probes
+
 // Backward compatibility
 #ifndef CLAMP
 #define CLAMP(val, min, max) ACCEL_CLAMP(val, min, max)
@@ -159,29 +252,114 @@ struct zmk_input_processor_state;
 // MEMORY POOL OPTIMIZATION
 // =============================================================================
 
-// Memory pool for acceleration data - reduces heap fragmentation
+// Devicetree instances with static per-instance tables (event counters,
+// deferred queues)
 #define ACCEL_MAX_INSTANCES 4
 
 // =============================================================================
 // DATA STRUCTURES - ULTRA-OPTIMIZED FOR MCU
 // =============================================================================
 
+/**
+ * Structure packing. Packed layouts are the smallest, but every multi-byte
+ * field is then read byte-wise on cores without unaligned access (Cortex-M0/M0+).
+ */
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_ALIGNED_LAYOUT)
+#define ACCEL_LAYOUT
+#else
+#define ACCEL_LAYOUT __packed
+#endif
+
 /**
  * @brief Ultra-compact acceleration data structure - 6 bytes total
  * Memory layout optimized for 32-bit ARM Cortex-M:
  * - 4 bytes: last_time_ms (uint32_t) - aligned to 4-byte boundary
  * - 2 bytes: recent_speed (uint16_t) - packed efficiently
  * Total: 6 bytes (was 8 bytes, 25% reduction)
+ * Adaptive rate detection adds 18 bytes, burst-aware timing 17, overflow
+ * carry 12, wide range 10, transform 12, deferred mode 9 (13 with adaptive rate)
+ * and latency budget 149 more when enabled. The aligned layout pads recent_speed to 4 bytes
+ * (8 bytes total) and adds a few bytes of padding per optional block.
+ */
+struct accel_deferred_queue;
+
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_INIT_TIMING)
+/**
+ * @brief Device init phases timed by CONFIG_INPUT_PROCESSOR_ACCEL_INIT_TIMING
  */
+enum accel_init_phase {
+    ACCEL_INIT_PHASE_CONFIG,       // Level defaults, preset, configuration logging
+    ACCEL_INIT_PHASE_DEVICETREE,   // Custom devicetree properties, transform
+    ACCEL_INIT_PHASE_VALIDATE,     // accel_validate_config()
+    ACCEL_INIT_PHASE_STATE,        // Runtime data reset, budget table
+    ACCEL_INIT_PHASE_PIPELINE,     // Event counters, stage chain, deferred queue
+    ACCEL_INIT_PHASE_COUNT,
+};
+#endif
+
 struct accel_data {
     uint32_t last_time_ms;         // Time tracking for speed calculation
-    uint16_t recent_speed;         // Recent speed (16-bit, sufficient for MCU)
+    accel_speed_t recent_speed;    // Recent speed (16-bit, 32-bit in wide-range mode)
     // Removed: speed_samples (not critical for performance)
     // Removed: reserved padding (not needed with 6-byte structure)
-} __packed;
-
-// Static memory pool for runtime data - declared here, defined in main.c
-extern struct k_mem_slab accel_data_pool;
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_ADAPTIVE_RATE)
+    uint32_t last_time_us;         // Fine-grained time of the previous event
+    uint16_t interval_samples[ACCEL_RATE_WINDOW_SIZE]; // Recent report intervals (us)
+    uint16_t report_interval_us;   // Median report interval, 0 until first estimate
+    uint8_t interval_index;        // Next slot in interval_samples
+    uint8_t interval_count;        // Valid entries in interval_samples
+#endif
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_BURST_TIMING)
+    uint32_t virtual_time_us;      // Spread timestamp of the current report
+    uint32_t burst_start_us;       // Arrival time of the first report in the burst
+    uint32_t sample_time_us;       // Driver-supplied timestamp for the next report
+    uint16_t conn_interval_us;     // Observed spacing between bursts
+    uint8_t burst_reports;         // Reports received in the current burst
+    uint8_t burst_size;            // Reports in the previous complete burst
+    uint8_t frame_open : 1;        // Current report already has a timestamp
+    uint8_t report_ended : 1;      // Previous event carried the sync flag
+    uint8_t sample_time_valid : 1; // sample_time_us is pending for the next report
+#endif
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_OVERFLOW_CARRY)
+    uint32_t carry_time_ms[ACCEL_CARRY_AXES]; // Time of the last event per axis (X, Y)
+    int16_t carry[ACCEL_CARRY_AXES]; // Undelivered output per axis (X, Y)
+#endif
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_WIDE_RANGE)
+    int32_t prescale_rem[2];       // Sub-count DPI pre-scale remainder per axis (Q16)
+#endif
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_TRANSFORM)
+    int32_t xform_cross;           // Other-axis term of the last event, not yet reported (counts)
+    int32_t xform_cur_x;           // X of the current report, for the Y event's X->Y term
+    int16_t xform_rem[2];          // Sub-count output remainder per axis (thousandths)
+#endif
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_DEFERRED)
+    struct accel_deferred_queue *deferred; // Event ring (deferred mode)
+    uint32_t event_time_ms;        // Arrival time of the event the worker is processing
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_ADAPTIVE_RATE)
+    uint32_t event_time_us;        // Same, microsecond base
+#endif
+    uint8_t event_time_valid : 1;  // event_time_* overrides the clock
+#endif
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_BUDGET)
+    uint32_t budget_overruns;      // Full-path events over the cycle budget
+    uint32_t budget_degradations;  // Switches to the LUT path
+    uint32_t budget_fast_events;   // Events handled by the LUT path
+    uint32_t budget_max_cycles;    // Longest measured event
+    uint8_t budget_over_streak;    // Consecutive over-budget events
+    uint8_t budget_ok_streak;      // Consecutive in-budget probes while degraded
+    uint8_t budget_probe_count;    // Degraded events since the last probe
+    uint8_t budget_lut_epoch;      // cfg->budget_epoch the table was built from
+    uint8_t budget_degraded : 1;   // LUT path active
+    uint8_t budget_fast : 1;       // Current event uses the LUT path
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_LAZY_STATE)
+    uint8_t budget_lut_ready : 1;  // budget_lut built (first event instead of init)
+#endif
+    int16_t budget_lut[ACCEL_BUDGET_LUT_SIZE]; // |input| -> output (X, before Y boost)
+#endif
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_INIT_TIMING)
+    uint32_t init_cycles[ACCEL_INIT_PHASE_COUNT]; // Boot-time init cost per phase
+#endif
+} ACCEL_LAYOUT;
 
 /**
  * @brief Level-specific configuration union - saves memory
@@ -204,24 +382,77 @@ union accel_level_config {
         uint8_t acceleration_exponent; // Exponential curve exponent
         uint8_t reserved;          // Padding for alignment
     } level2;                      // 10 bytes for Level 2
-} __packed;
+} ACCEL_LAYOUT;
+
+struct accel_log_state;
+
+/**
+ * @brief Per-event state passed along the processing pipeline
+ */
+struct accel_stage_ctx {
+    const struct accel_config *cfg;
+    struct accel_data *data;
+    uint16_t code;                 // Event code
+    bool sync;                     // Last event of the report
+    int32_t input;                 // Clamped input value
+    int32_t calc_input;            // Input given to the level calculation
+    int32_t value;                 // Running output value
+};
+
+/**
+ * @brief Processing stage; returns false to stop the chain and emit ctx->value
+ */
+typedef bool (*accel_stage_fn)(struct accel_stage_ctx *ctx);
 
 /**
  * @brief Ultra-optimized acceleration configuration structure
- * Memory layout: 20 bytes total (was ~32 bytes, 37.5% reduction)
- * - 8 bytes: pointer + uint32_t (codes, codes_count)
- * - 10 bytes: union accel_level_config (max size)
- * - 2 bytes: packed fields (y_boost, sensor_dpi as scaled values)
+ * Memory layout: 29 bytes plus the stage chain (ACCEL_MAX_STAGES pointers + count)
+ * and the event log pointer, packed
+ * Field order only, one struct (no separate cold struct):
+ * - First, read per event: stage chain, log pointer, DPI-adjusted
+ *   sensitivity, union accel_level_config (12 bytes max), transform,
+ *   y_boost (scaled), input type, level
+ * - Last, used by init, setters and logging: codes pointer + count, exact
+ *   sensor DPI
+ * The words setters update at runtime are 4-byte aligned in both layouts, so
+ * on 32-bit targets the base layout is 68 bytes (66 plus tail padding), the
+ * per-event fields in the first 56. CONFIG_INPUT_PROCESSOR_ACCEL_ALIGNED_LAYOUT
+ * also aligns the remaining fields.
  */
 struct accel_config {
-    const uint16_t *codes;         // Pointer to codes array
-    uint32_t codes_count;          // Number of codes
+    // Read per event
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_CONST_CONFIG)
+    const accel_stage_fn *stages;  // Processing chain (shared per level, in flash)
+#else
+    accel_stage_fn stages[ACCEL_MAX_STAGES]; // Processing chain, built at init
+#endif
+    struct accel_log_state *log;   // Hot-path event flags and counters (NULL: not recorded)
+    // Runtime-updatable words: aligned even in the packed layout, so the
+    // handler reads each with one load and no lock
+    uint32_t dpi_sensitivity __aligned(4); // ACCEL_DPI_SENSITIVITY() of sensitivity and DPI
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_WIDE_RANGE)
+    uint32_t prescale_q16 __aligned(4); // ACCEL_PRESCALE_Q16(sensor_dpi), 0: no pre-scale
+#endif
     union accel_level_config cfg;  // Level-specific configuration
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_TRANSFORM)
+    int16_t transform[ACCEL_TRANSFORM_SIZE]; // 2x2 output matrix (thousandths, row-major)
+    uint8_t transform_active;      // Matrix is not identity
+#endif
     uint8_t y_boost_scaled;        // Y-axis boost (scaled: 100-300 = 1.0x-3.0x)
-    uint8_t sensor_dpi_class;      // DPI class: 0=400, 1=800, 2=1200, 3=1600, 4=3200, 5=6400
     uint8_t input_type;            // Input event type
     uint8_t level;                 // Configuration level (1 or 2)
-} __packed;
+    uint8_t stage_count;           // Active stages
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_BUDGET)
+    uint8_t budget_epoch;          // Bumped by the setters; a differing budget_lut_epoch rebuilds the table
+#endif
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_TRACING)
+    uint8_t instance;              // DT instance number (trace id)
+#endif
+    // Init, setters and logging
+    const uint16_t *codes;         // Pointer to codes array
+    uint32_t codes_count;          // Number of codes
+    uint16_t sensor_dpi;           // Exact sensor DPI
+} ACCEL_LAYOUT;
 
 // =============================================================================
 // FUNCTION DECLARATIONS
@@ -239,12 +470,6 @@ int accel_validate_config(const struct accel_config *cfg);
  * Note: This functionality is handled during device tree initialization
  */
 
-/**
- * @brief Memory pool management functions
- */
-struct accel_data *accel_data_alloc(void);
-void accel_data_free(struct accel_data *data);
-
 /**
  * @brief Decode scaled configuration values
  */
@@ -252,28 +477,98 @@ static inline uint16_t accel_decode_y_boost(uint8_t scaled) {
     return 1000 + (scaled * 10); // 100-300 -> 1000-3000
 }
 
-static inline uint16_t accel_decode_sensor_dpi(uint8_t dpi_class) {
-    static const uint16_t dpi_table[] = {400, 800, 1200, 1600, 3200, 6400, 8000, 800};
-    const size_t dpi_table_size = sizeof(dpi_table) / sizeof(dpi_table[0]);
-    
-    // Enhanced bounds checking: validate array size at compile time
-    __ASSERT_NO_MSG(dpi_table_size == 8);
-    
-    // Runtime bounds checking with explicit size validation
-    if (dpi_class >= dpi_table_size) {
-        // Use printk for header file (no LOG module available)
-        printk("ACCEL: Invalid DPI class %u (max %zu), using default 800 DPI\n", 
-               dpi_class, dpi_table_size - 1);
-        return 800; // Safe default value
+/**
+ * @brief DPI-adjusted sensitivity for the current event
+ * Recomputed by the sensitivity and DPI setters (accel_update_sensor_dpi()
+ * under irq_lock()); one aligned word, so no lock is needed to read it.
+ */
+static inline uint32_t accel_get_dpi_sensitivity(const struct accel_config *cfg) {
+    return cfg->dpi_sensitivity;
+}
+
+/**
+ * @brief Conditions recorded on the hot path instead of being logged there
+ */
+enum accel_log_event {
+    ACCEL_LOG_INPUT_REJECTED,      // Input beyond MAX_EXTREME_INPUT dropped
+    ACCEL_LOG_INVALID_CONFIG,      // Out-of-range sensitivity, DPI, speed or boost setting
+    ACCEL_LOG_OVERFLOW,            // Overflow guard took the conservative path
+    ACCEL_LOG_CLAMPED,             // Result clamped to the int16 range
+    ACCEL_LOG_SUSPICIOUS,          // Implausible result replaced by a conservative one
+    ACCEL_LOG_SPEED_RESET,         // Corrupt speed state reset
+    ACCEL_LOG_SPEED_FALLBACK,      // Speed beyond MAX_REASONABLE_SPEED, fallback used
+    ACCEL_LOG_EVENT_COUNT,
+};
+
+/**
+ * @brief Per-instance event flags and counters
+ * Written with atomics from the event path; strings are only formatted by
+ * the periodic summary work item.
+ */
+struct accel_log_state {
+    const struct device *dev;      // Owning instance
+    atomic_t flags;                // Events seen since the last summary (bit per event)
+    atomic_t counts[ACCEL_LOG_EVENT_COUNT]; // Total occurrences per event
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_DEBUG_LOG)
+    // Latest level calculation (input, speed, factor, output); plain stores,
+    // a torn read only affects the debug line
+    int32_t debug[4];
+#endif
+    uint32_t reported[ACCEL_LOG_EVENT_COUNT]; // Totals at the last summary (work item only)
+};
+
+/**
+ * @brief Record a hot-path condition (no string formatting)
+ */
+static inline void accel_log_event(const struct accel_config *cfg, enum accel_log_event event) {
+    struct accel_log_state *log = cfg->log;
+    if (log) {
+        atomic_or(&log->flags, BIT(event));
+        atomic_inc(&log->counts[event]);
+    }
+}
+
+/**
+ * @brief Keep the latest level calculation for the periodic summary
+ * Compiled out unless CONFIG_INPUT_PROCESSOR_ACCEL_DEBUG_LOG is set.
+ */
+static inline void accel_log_debug(const struct accel_config *cfg, int32_t input,
+                                   uint32_t speed, uint32_t factor, int32_t output) {
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_DEBUG_LOG)
+    struct accel_log_state *log = cfg->log;
+    if (log) {
+        log->debug[0] = input;
+        log->debug[1] = (int32_t)speed;
+        log->debug[2] = (int32_t)factor;
+        log->debug[3] = output;
     }
-    return dpi_table[dpi_class];
+#else
+    ARG_UNUSED(cfg);
+    ARG_UNUSED(input);
+    ARG_UNUSED(speed);
+    ARG_UNUSED(factor);
+    ARG_UNUSED(output);
+#endif
 }
 
+/**
+ * @brief Zephyr named trace event (CTF timelines)
+ * arg0 = instance << 16 | event code (0 where no code applies), arg1 = value.
+ * "_start"/"_end" pairs bracket a stage; compiled out unless tracing is enabled.
+ */
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_TRACING)
+#define ACCEL_TRACE(cfg, name, code, value)                                        \
+    sys_trace_named_event("accel_" name,                                           \
+                          ((uint32_t)(cfg)->instance << 16) | (uint16_t)(code),    \
+                          (uint32_t)(value))
+#else
+#define ACCEL_TRACE(cfg, name, code, value) ((void)0)
+#endif
+
 /**
  * @brief Encode configuration values to scaled format (declared in accel_config.c)
  */
 uint8_t accel_encode_y_boost(uint16_t y_boost);
-uint8_t accel_encode_sensor_dpi(uint16_t sensor_dpi);
 
 /**
  * @brief Safely clamp input value to prevent overflow - optimized for speed
@@ -289,7 +584,55 @@ static inline int32_t accel_clamp_input_value(int32_t input_value) {
 }
 
 uint32_t accel_safe_quadratic_curve(int32_t abs_input, uint32_t multiplier);
-int32_t accel_safe_fallback_calculate(int32_t input_value, uint32_t max_factor);
+int32_t accel_safe_fallback_calculate(const struct accel_config *cfg, int32_t input_value,
+                                      uint32_t max_factor);
+
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_WIDE_RANGE)
+int32_t accel_dpi_prescale(const struct accel_config *cfg, struct accel_data *data,
+                           uint16_t code, int32_t value);
+#endif
+
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_OVERFLOW_CARRY)
+int32_t accel_carry_apply(struct accel_data *data, uint16_t code, int32_t value);
+#endif
+
+/**
+ * @brief Build an instance's stage chain from its configuration
+ * Called once at init; rebuild after changing level or transform.
+ * @param cfg Acceleration configuration
+ * @return 0 on success, negative error code on failure
+ */
+int accel_pipeline_build(struct accel_config *cfg);
+
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_CONST_CONFIG)
+// Compile-time stage chains (stage count: filter, level, brake/carry,
+// minimum movement, plus burst timing and the clamp when enabled)
+#define ACCEL_PIPELINE_CONST_STAGES                                                             \
+    (4 + IS_ENABLED(CONFIG_INPUT_PROCESSOR_ACCEL_BURST_TIMING) +                                \
+     !IS_ENABLED(CONFIG_INPUT_PROCESSOR_ACCEL_FAST_PATH))
+extern const accel_stage_fn accel_pipeline_level1[ACCEL_PIPELINE_CONST_STAGES];
+extern const accel_stage_fn accel_pipeline_level2[ACCEL_PIPELINE_CONST_STAGES];
+#endif
+
+/**
+ * @brief Run one event through an instance's stage chain
+ * @return Processed value
+ */
+int32_t accel_pipeline_run(const struct accel_config *cfg, struct accel_data *data,
+                           uint16_t code, int32_t value, bool sync);
+
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_XY_KERNEL)
+/**
+ * @brief Run a report's X and Y events through the chain, level stage packed
+ * Both deltas must be non-zero and share one arrival time. Output equals
+ * accel_pipeline_run() for X then Y. Nothing runs when the pair cannot be
+ * packed (burst timing, DPI pre-scale, budget table path).
+ * @param sync Sync flag of the Y event (X is not the last event)
+ * @return true if *x and *y now hold the outputs
+ */
+bool accel_pipeline_run_xy(const struct accel_config *cfg, struct accel_data *data,
+                           int32_t *x, int32_t *y, bool sync);
+#endif
 
 int accel_handle_event(const struct device *dev, struct input_event *event,
                       uint32_t param1, uint32_t param2,
@@ -300,6 +643,235 @@ int32_t accel_simple_calculate(const struct accel_config *cfg, int32_t input_val
 int32_t accel_standard_calculate(const struct accel_config *cfg, struct accel_data *data, 
                                 int32_t input_value, uint16_t code);
 
+// Level-specific factor computation (shared by the per-event and XY paths)
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_LEVEL_SIMPLE)
+uint32_t accel_simple_curve_factor(const struct accel_config *cfg, int32_t abs_input);
+#endif
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_LEVEL_STANDARD)
+uint32_t accel_standard_speed_factor(const struct accel_config *cfg, uint32_t speed);
+#endif
+
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_TRANSFORM)
+/**
+ * @brief Set the 2x2 output transform (rotation, per-axis gain, shear)
+ * Entries are thousandths, clamped to +/-ACCEL_TRANSFORM_MAX:
+ * x' = (m00 * x + m01 * y) / 1000, y' = (m10 * x + m11 * y) / 1000
+ */
+void accel_transform_set(struct accel_config *cfg, int32_t m00, int32_t m01,
+                         int32_t m10, int32_t m11);
+
+/**
+ * @brief Transform one accelerated X/Y event (other codes pass through)
+ * The X->Y term uses X of the same report. X is delivered before Y, so the
+ * Y->X term of a Y event (and the X->Y term of an X-only report) is left
+ * for accel_transform_take_cross().
+ */
+int32_t accel_transform_event(const struct accel_config *cfg, struct accel_data *data,
+                              uint16_t code, int32_t value, bool sync);
+
+/**
+ * @brief Take the counts the last event left for the other axis (0 if none)
+ * Whoever ran the pipeline reports them right away, as a REL_Y event after
+ * REL_X and a REL_X event after REL_Y.
+ */
+int32_t accel_transform_take_cross(struct accel_data *data);
+
+/**
+ * @brief Transform both accelerated axes of a report (frame path, no delay)
+ */
+void accel_transform_xy(const struct accel_config *cfg, struct accel_data *data,
+                        int32_t *x, int32_t *y);
+#endif // CONFIG_INPUT_PROCESSOR_ACCEL_TRANSFORM
+
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_DEFERRED)
+/**
+ * @brief Deferred-mode queue counters of one instance
+ */
+struct accel_deferred_stats {
+    uint32_t enqueued;             // Events accepted into the ring
+    uint32_t processed;            // Events run through the pipeline and reported by the worker
+    uint32_t coalesced;            // Events folded into queued entries because the ring was full
+    uint32_t dropped;              // Events discarded: full ring, every queued entry at the input limit
+    uint16_t high_water;           // Highest ring occupancy seen
+    uint16_t depth;                // Ring capacity
+};
+
+/**
+ * @brief Register an instance with the deferred worker (called at init)
+ * @return 0 on success, -ENOMEM if all queues are in use
+ */
+int accel_deferred_attach(const struct device *dev);
+
+/**
+ * @brief Queue a raw event with its arrival time for the worker
+ * Called by the event handler, from any context (the queue is guarded by a
+ * spinlock). The worker runs the stage chain and reports the processed event
+ * with input_report() from the acceleration device. On a full ring the delta
+ * is folded into a queued entry of the same code, so no motion is lost; it is
+ * dropped only when every queued entry is already at the input limit.
+ * @return 0 if queued, folded or dropped, -EINVAL if the instance has no queue
+ */
+int accel_deferred_enqueue(struct accel_data *data, uint16_t code, int32_t value, bool sync);
+
+/**
+ * @brief Read the queue counters of an instance
+ * @param dev Acceleration processor device
+ * @param stats Output counters
+ * @return 0 on success, -EINVAL on invalid arguments or unattached device
+ */
+int accel_deferred_get_stats(const struct device *dev, struct accel_deferred_stats *stats);
+#endif // CONFIG_INPUT_PROCESSOR_ACCEL_DEFERRED
+
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_BUDGET)
+/**
+ * @brief Latency budget watchdog counters of one instance
+ */
+struct accel_budget_stats {
+    uint32_t overruns;             // Full-path events over the cycle budget
+    uint32_t degradations;         // Switches to the LUT path
+    uint32_t fast_events;          // Events handled by the LUT path
+    uint32_t max_cycles;           // Longest measured event (cycles)
+    bool degraded;                 // LUT path currently active
+};
+
+/**
+ * @brief Precompute the fast-path table from the instance's Level 2 settings
+ * Called at init and after a sensor DPI change.
+ */
+void accel_budget_build_lut(const struct accel_config *cfg, struct accel_data *data);
+
+/**
+ * @brief Run one event through the stage chain under the cycle budget
+ * After CONFIG_INPUT_PROCESSOR_ACCEL_BUDGET_OVERRUNS consecutive overruns the
+ * Level 2 stage uses the LUT; as many in-budget probes switch back.
+ * @return Processed value
+ */
+int32_t accel_budget_run(const struct accel_config *cfg, struct accel_data *data,
+                         uint16_t code, int32_t value, bool sync);
+
+/**
+ * @brief Fast-path Level 2 replacement: table lookup plus Y boost
+ * The lookup ignores speed, but the speed state is still updated so the
+ * full calculation resumes from the current speed.
+ */
+int32_t accel_budget_lut_calculate(const struct accel_config *cfg, struct accel_data *data,
+                                   int32_t input_value, uint16_t code);
+
+/**
+ * @brief Read the watchdog counters of an instance
+ * @return 0 on success, -EINVAL on invalid arguments
+ */
+int accel_budget_get_stats(const struct device *dev, struct accel_budget_stats *stats);
+#endif // CONFIG_INPUT_PROCESSOR_ACCEL_BUDGET
+
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_CONTEXTS)
+/**
+ * @brief Runtime-created acceleration state sharing a device's configuration
+ * Independent speed tracking, remainders and counters for e.g. one BLE host
+ * profile or one layer; the config and stage chain stay those of the device.
+ * Blocks come from a slab of CONFIG_INPUT_PROCESSOR_ACCEL_CONTEXT_COUNT.
+ */
+struct accel_context {
+    const struct device *dev;      // Device whose configuration is applied
+    struct accel_data data;        // State of this context only
+};
+
+/**
+ * @brief Take a context from the slab, bound to a ready acceleration device
+ * O(1), never blocks; safe from any thread.
+ * @return Context with reset state, or NULL if the slab is exhausted or dev
+ *         has no configuration
+ */
+struct accel_context *accel_context_create(const struct device *dev);
+
+/**
+ * @brief Return a context to the slab (O(1)); NULL is ignored
+ */
+void accel_context_destroy(struct accel_context *ctx);
+
+/**
+ * @brief Forget the speed history and remainders of a context
+ * E.g. when its host profile becomes active again.
+ * @return 0 on success, -EINVAL on invalid arguments
+ */
+int accel_context_reset(struct accel_context *ctx);
+
+/**
+ * @brief Process an input event with the context's state
+ * Same filtering and calculation as the device's handler; always runs the
+ * full calculation synchronously (no deferred worker, no cycle budget).
+ * @return ZMK_INPUT_PROC_CONTINUE, or a negative error code
+ */
+int accel_context_handle_event(struct accel_context *ctx, struct input_event *event);
+
+/**
+ * @brief Number of contexts currently taken from the slab
+ */
+uint32_t accel_context_count(void);
+#endif // CONFIG_INPUT_PROCESSOR_ACCEL_CONTEXTS
+
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_XY_KERNEL)
+/**
+ * @brief Packed dual-axis word: X in bits 0-15, Y in bits 16-31 (int16 each)
+ */
+typedef uint32_t accel_xy_t;
+
+static inline accel_xy_t accel_xy_pack(int16_t x, int16_t y) {
+    return (uint32_t)(uint16_t)x | ((uint32_t)(uint16_t)y << 16);
+}
+
+static inline int16_t accel_xy_get_x(accel_xy_t xy) {
+    return (int16_t)(uint16_t)(xy & 0xFFFF);
+}
+
+static inline int16_t accel_xy_get_y(accel_xy_t xy) {
+    return (int16_t)(uint16_t)(xy >> 16);
+}
+
+// Packed kernel gains: thousandths as Q25 factors, rounded up (see accel_xy_gain())
+#define ACCEL_XY_GAIN_SHIFT 25
+
+/**
+ * @brief Q25 kernel gain for a gain in thousandths (0..INT16_MAX)
+ * floor(gain * 2^25 / 1000) + 1: the error stays below 1/1000 of a count for
+ * any int16 lane, so the kernel's products round like the truncating divide.
+ */
+static inline int32_t accel_xy_gain(uint16_t gain) {
+    return (int32_t)(gain * 33554U + (gain * 432U) / SENSITIVITY_SCALE + 1U);
+}
+
+/**
+ * @brief Scale both halves by their own gain: lane = sat16(lane * gain / 1000)
+ * @param xy Packed deltas
+ * @param gain_x Q25 gain of the X half (accel_xy_gain())
+ * @param gain_y Q25 gain of the Y half (accel_xy_gain())
+ * @return Packed results (division truncates toward zero, like the scalar path)
+ */
+accel_xy_t accel_xy_scale(accel_xy_t xy, int32_t gain_x, int32_t gain_y);
+
+/**
+ * @brief Level calculation of one report's X and Y (no transform)
+ * Same results and speed state update as accel_simple_calculate() or
+ * accel_standard_calculate() for X then Y, zero axes skipped (output 0).
+ */
+void accel_xy_level(const struct accel_config *cfg, struct accel_data *data,
+                    const int32_t in[2], int32_t out[2]);
+
+/**
+ * @brief Accelerate one report's X and Y deltas together
+ * Equivalent to the level calculation for X then Y (zero axes skipped),
+ * including the speed state update. Inputs outside +/-MAX_REASONABLE_INPUT
+ * use the scalar path.
+ * @param cfg Acceleration configuration
+ * @param data Acceleration data structure
+ * @param x X delta in, accelerated X out
+ * @param y Y delta in, accelerated Y out
+ * @return 0 on success, -EINVAL on invalid arguments
+ */
+int accel_calculate_xy(const struct accel_config *cfg, struct accel_data *data,
+                       int32_t *x, int32_t *y);
+#endif // CONFIG_INPUT_PROCESSOR_ACCEL_XY_KERNEL
+
 // Common calculation functions (shared between levels)
 int64_t safe_multiply_64(int64_t a, int64_t b, int64_t max_result);
 int32_t safe_int64_to_int32(int64_t value);
@@ -313,6 +885,131 @@ uint32_t calculate_exponential_curve(uint32_t t, uint8_t exponent);
 // Simplified speed calculation functions
 uint32_t accel_calculate_simple_speed(struct accel_data *data, int32_t input_value);
 
+/**
+ * @brief Time source of the module
+ * uptime_ms must match k_uptime_get_32() semantics (wraps at 2^32 ms) and
+ * uptime_us the k_uptime_ticks() microsecond base (wraps at 2^32 us).
+ */
+struct accel_clock {
+    uint32_t (*uptime_ms)(void *user_data);
+    uint32_t (*uptime_us)(void *user_data);
+    void *user_data;
+};
+
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_CLOCK_HOOK)
+/**
+ * @brief Replace the time source of all instances
+ * Set it before events flow (or from the input thread): events read it
+ * without locking.
+ * @param clock New time source (must stay valid), NULL for the kernel uptime
+ * @return 0 on success, -EINVAL if a function pointer is missing
+ */
+int accel_set_clock(const struct accel_clock *clock);
+
+uint32_t accel_clock_ms(void);
+uint32_t accel_clock_us(void);
+#else
+static inline uint32_t accel_clock_ms(void) {
+    return k_uptime_get_32();
+}
+
+static inline uint32_t accel_clock_us(void) {
+    // Tick-based microseconds; wraps every ~71 minutes, deltas stay valid
+    return (uint32_t)k_ticks_to_us_floor64(k_uptime_ticks());
+}
+#endif
+
+/**
+ * @brief Time of the event being processed
+ * In deferred mode the worker stamps each event's arrival time into data;
+ * synchronous callers leave it unset and read the clock.
+ */
+static inline uint32_t accel_event_time_ms(const struct accel_data *data) {
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_DEFERRED)
+    if (data->event_time_valid) {
+        return data->event_time_ms;
+    }
+#endif
+    ARG_UNUSED(data);
+    return accel_clock_ms();
+}
+
+static inline uint32_t accel_event_time_us(const struct accel_data *data) {
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_DEFERRED) && defined(CONFIG_INPUT_PROCESSOR_ACCEL_ADAPTIVE_RATE)
+    if (data->event_time_valid) {
+        return data->event_time_us;
+    }
+#endif
+    ARG_UNUSED(data);
+    return accel_clock_us();
+}
+
+/**
+ * @brief Get the estimated sensor report interval of an instance
+ * @param dev Acceleration processor device
+ * @return Median report interval in microseconds, 0 if unknown or adaptive rate is disabled
+ */
+uint16_t accel_get_report_interval_us(const struct device *dev);
+
+/**
+ * @brief Supply the sensor sample time of the next report (burst-aware timing)
+ * Transports that know when a report was sampled (e.g. a split peripheral that
+ * forwards a timestamp or sequence number) call this before reporting it, so
+ * speed uses the sample time instead of the arrival time.
+ * @param dev Acceleration processor device
+ * @param sample_time_us Sample time in the accel_clock_us() microsecond base
+ * @return 0 on success, -ENOTSUP if burst-aware timing is disabled
+ */
+int accel_set_sample_time_us(const struct device *dev, uint32_t sample_time_us);
+
+/**
+ * @brief Attach an instance's event log state (called at init)
+ * @return 0 on success, -ENOMEM if all log states are in use
+ */
+int accel_log_attach(const struct device *dev);
+
+/**
+ * @brief Read an instance's hot-path event counters
+ * @param dev Acceleration processor device
+ * @param counts Output, indexed by enum accel_log_event
+ * @return 0 on success, -EINVAL on invalid arguments or unattached device
+ */
+int accel_get_event_counts(const struct device *dev, uint32_t counts[ACCEL_LOG_EVENT_COUNT]);
+
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_INIT_TIMING)
+/**
+ * @brief Read the cycles each init phase of an instance took at boot
+ * @return 0 on success, -EINVAL on invalid arguments
+ */
+int accel_get_init_cycles(const struct device *dev, uint32_t cycles[ACCEL_INIT_PHASE_COUNT]);
+#endif
+
+/**
+ * @brief Announce a runtime sensor DPI change (e.g. a DPI button on the device)
+ *
+ * Sensor drivers call this after switching resolution. The exact DPI and the
+ * DPI-adjusted sensitivity derived from it are replaced together, so events
+ * never see a mismatched pair.
+ * @param dev Acceleration processor device
+ * @param sensor_dpi New sensor DPI (clamped to SENSOR_DPI_MIN..SENSOR_DPI_MAX)
+ * @return 0 on success, -EINVAL on invalid device, -ENOTSUP with
+ *         CONFIG_INPUT_PROCESSOR_ACCEL_CONST_CONFIG (configuration in flash)
+ */
+int accel_update_sensor_dpi(const struct device *dev, uint16_t sensor_dpi);
+
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_BURST_TIMING)
+/**
+ * @brief Track report boundaries for burst-aware timing
+ * Called by the event handler for every accelerated-axis event, including zero ones.
+ */
+static inline void accel_burst_track_event(struct accel_data *data, bool sync) {
+    if (data->report_ended) {
+        data->frame_open = 0;
+    }
+    data->report_ended = sync;
+}
+#endif
+
 #ifdef __cplusplus
 }
 #endif
\ No newline at end of file
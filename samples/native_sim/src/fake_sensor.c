@@ -0,0 +1,179 @@
+// fake_sensor.c - Synthetic relative motion sensor for the native_sim sample
+// Reports REL_X/REL_Y through the Zephyr input subsystem like a real sensor
+// driver, at a fixed report rate in simulated time
+//
+// SPDX-License-Identifier: MIT
+
+#define DT_DRV_COMPAT zmk_accel_fake_sensor
+
+#include <zephyr/device.h>
+#include <zephyr/kernel.h>
+#include <zephyr/input/input.h>
+#include <zephyr/logging/log.h>
+#include "fake_sensor.h"
+#include "host_clock.h"
+
+LOG_MODULE_REGISTER(fake_sensor, LOG_LEVEL_INF);
+
+// Reports per circle revolution (4 degrees per report)
+#define FAKE_CIRCLE_STEP_DEG 4
+// Flick cycle: a bell-shaped stroke followed by a pause of the same length
+#define FAKE_FLICK_STROKE 60
+#define FAKE_FLICK_CYCLE  (2 * FAKE_FLICK_STROKE)
+
+struct fake_sensor_config {
+    uint32_t rate_hz;
+    int16_t amplitude;
+    uint8_t trajectory;
+    uint32_t seed;
+};
+
+struct fake_sensor_data {
+    uint32_t tick;                 // Reports since the trajectory started
+    uint32_t rng;                  // xorshift32 state (jitter)
+    uint8_t trajectory;
+    uint64_t event_start_ns;       // Host time of the event being delivered
+};
+
+static const char *const fake_trajectory_names[FAKE_TRAJECTORY_COUNT] = {
+    [FAKE_TRAJECTORY_LINE] = "line",
+    [FAKE_TRAJECTORY_CIRCLE] = "circle",
+    [FAKE_TRAJECTORY_FLICK] = "flick",
+    [FAKE_TRAJECTORY_JITTER] = "jitter",
+};
+
+// sin(deg) * 1024, Bhaskara I approximation (integer only)
+static int32_t fake_sin_q10(uint32_t deg) {
+    int32_t sign = 1;
+
+    deg %= 360;
+    if (deg >= 180) {
+        deg -= 180;
+        sign = -1;
+    }
+    int32_t p = (int32_t)(deg * (180 - deg));
+    return sign * (4 * p * 1024) / (40500 - p);
+}
+
+static uint32_t fake_rng_next(struct fake_sensor_data *data) {
+    uint32_t x = data->rng;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    data->rng = x;
+    return x;
+}
+
+/**
+ * @brief Compute the next report of the active trajectory
+ * @return false during pauses (nothing is reported)
+ */
+static bool fake_sensor_step(const struct fake_sensor_config *cfg, struct fake_sensor_data *data,
+                             int16_t *dx, int16_t *dy) {
+    uint32_t tick = data->tick++;
+    int32_t amp = cfg->amplitude;
+
+    switch (data->trajectory) {
+    case FAKE_TRAJECTORY_LINE:
+        *dx = amp;
+        *dy = amp / 2;
+        return true;
+
+    case FAKE_TRAJECTORY_CIRCLE: {
+        uint32_t deg = tick * FAKE_CIRCLE_STEP_DEG;
+        *dx = (int16_t)(amp * fake_sin_q10(deg + 90) / 1024);
+        *dy = (int16_t)(amp * fake_sin_q10(deg) / 1024);
+        return true;
+    }
+
+    case FAKE_TRAJECTORY_FLICK: {
+        uint32_t phase = tick % FAKE_FLICK_CYCLE;
+        if (phase >= FAKE_FLICK_STROKE) {
+            return false;
+        }
+        // Velocity 4t(1-t) peaks at amp mid-stroke; strokes alternate direction
+        int32_t v = amp * 4 * (int32_t)phase * (FAKE_FLICK_STROKE - (int32_t)phase) /
+                    (FAKE_FLICK_STROKE * FAKE_FLICK_STROKE);
+        if ((tick / FAKE_FLICK_CYCLE) & 1) {
+            v = -v;
+        }
+        *dx = (int16_t)v;
+        *dy = (int16_t)(v / 4);
+        return v != 0;
+    }
+
+    default: { // FAKE_TRAJECTORY_JITTER
+        uint32_t r = fake_rng_next(data);
+        *dx = (int16_t)((int32_t)(r % 3) - 1);
+        *dy = (int16_t)((int32_t)((r >> 8) % 3) - 1);
+        return *dx != 0 || *dy != 0;
+    }
+    }
+}
+
+void fake_sensor_set_trajectory(const struct device *dev, enum fake_trajectory trajectory) {
+    const struct fake_sensor_config *cfg = dev->config;
+    struct fake_sensor_data *data = dev->data;
+
+    data->trajectory = (trajectory < FAKE_TRAJECTORY_COUNT) ? trajectory : FAKE_TRAJECTORY_LINE;
+    data->tick = 0;
+    data->rng = cfg->seed ? cfg->seed : 1;
+}
+
+uint32_t fake_sensor_emit(const struct device *dev, uint32_t reports) {
+    const struct fake_sensor_config *cfg = dev->config;
+    struct fake_sensor_data *data = dev->data;
+    k_timeout_t period = K_USEC(USEC_PER_SEC / cfg->rate_hz);
+    uint32_t events = 0;
+
+    for (uint32_t i = 0; i < reports; i++) {
+        int16_t dx;
+        int16_t dy;
+
+        if (fake_sensor_step(cfg, data, &dx, &dy)) {
+            data->event_start_ns = host_clock_ns();
+            input_report_rel(dev, INPUT_REL_X, dx, false, K_FOREVER);
+            data->event_start_ns = host_clock_ns();
+            input_report_rel(dev, INPUT_REL_Y, dy, true, K_FOREVER);
+            events += 2;
+        }
+        k_sleep(period);
+    }
+    return events;
+}
+
+uint64_t fake_sensor_event_start_ns(const struct device *dev) {
+    const struct fake_sensor_data *data = dev->data;
+
+    return data->event_start_ns;
+}
+
+const char *fake_sensor_trajectory_name(enum fake_trajectory trajectory) {
+    return (trajectory < FAKE_TRAJECTORY_COUNT) ? fake_trajectory_names[trajectory] : "?";
+}
+
+static int fake_sensor_init(const struct device *dev) {
+    const struct fake_sensor_config *cfg = dev->config;
+
+    if (cfg->rate_hz == 0 || cfg->rate_hz > USEC_PER_SEC) {
+        LOG_ERR("%s: report-rate-hz must be 1..1000000", dev->name);
+        return -EINVAL;
+    }
+    fake_sensor_set_trajectory(dev, cfg->trajectory);
+    return 0;
+}
+
+#define FAKE_SENSOR_DEFINE(inst)                                                                 \
+    static struct fake_sensor_data fake_sensor_data_##inst;                                     \
+    static const struct fake_sensor_config fake_sensor_config_##inst = {                        \
+        .rate_hz = DT_INST_PROP(inst, report_rate_hz),                                          \
+        .amplitude = DT_INST_PROP(inst, amplitude),                                             \
+        .trajectory = DT_INST_ENUM_IDX(inst, trajectory),                                       \
+        .seed = DT_INST_PROP(inst, seed),                                                       \
+    };                                                                                           \
+    DEVICE_DT_INST_DEFINE(inst, fake_sensor_init, NULL, &fake_sensor_data_##inst,                \
+                          &fake_sensor_config_##inst, POST_KERNEL,                               \
+                          CONFIG_KERNEL_INIT_PRIORITY_DEVICE, NULL);
+
+DT_INST_FOREACH_STATUS_OKAY(FAKE_SENSOR_DEFINE)
@@ -0,0 +1,35 @@
+// fake_sensor.h - Synthetic relative motion sensor for the native_sim sample
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <stdint.h>
+#include <zephyr/device.h>
+
+enum fake_trajectory {
+    FAKE_TRAJECTORY_LINE,
+    FAKE_TRAJECTORY_CIRCLE,
+    FAKE_TRAJECTORY_FLICK,
+    FAKE_TRAJECTORY_JITTER,
+    FAKE_TRAJECTORY_COUNT,
+};
+
+/**
+ * @brief Select the motion pattern and restart it from its first report
+ */
+void fake_sensor_set_trajectory(const struct device *dev, enum fake_trajectory trajectory);
+
+/**
+ * @brief Emit reports at the configured rate (simulated time)
+ * Each moving report is REL_X then REL_Y with sync; pauses emit nothing.
+ * @return Number of events reported
+ */
+uint32_t fake_sensor_emit(const struct device *dev, uint32_t reports);
+
+/**
+ * @brief Host time at which the event being delivered was reported
+ */
+uint64_t fake_sensor_event_start_ns(const struct device *dev);
+
+const char *fake_sensor_trajectory_name(enum fake_trajectory trajectory);
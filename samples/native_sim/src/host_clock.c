@@ -0,0 +1,13 @@
+// host_clock.c - Host monotonic clock (built against the host C library)
+//
+// SPDX-License-Identifier: MIT
+
+#include <stdint.h>
+#include <time.h>
+
+uint64_t host_clock_ns(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
@@ -0,0 +1,11 @@
+// host_clock.h - Host monotonic clock for the native_sim sample
+// Simulated time stands still while code runs, so CPU cost is measured
+// against the host clock instead of k_cycle_get_32()
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <stdint.h>
+
+uint64_t host_clock_ns(void);
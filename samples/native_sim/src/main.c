@@ -0,0 +1,186 @@
+// main.c - native_sim end-to-end benchmark of the acceleration processor
+// A fake sensor reports through the Zephyr input subsystem; the listener
+// below hands each event to the real DT instance the way ZMK's input
+// listener does, and measures host-time cost per event
+//
+// SPDX-License-Identifier: MIT
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/init.h>
+#include <zephyr/input/input.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/version.h>
+#include <string.h>
+#include <drivers/input_processor.h>
+#include <drivers/input_processor_accel.h>
+#include "fake_sensor.h"
+#include "host_clock.h"
+
+#define SENSOR_NODE DT_NODELABEL(fake_sensor)
+#define ACCEL_NODE  DT_NODELABEL(pointer_accel)
+
+// Latency histogram: bucket b holds [2^b, 2^(b+1)) ns
+#define SAMPLE_HIST_BUCKETS 32
+
+static const struct device *const sensor = DEVICE_DT_GET(SENSOR_NODE);
+static const struct device *const accel = DEVICE_DT_GET(ACCEL_NODE);
+
+struct sample_stats {
+    uint32_t events;
+    uint32_t errors;
+    uint64_t proc_ns;              // Sum of processor time
+    uint64_t proc_max_ns;
+    uint64_t e2e_ns;               // Sum of report-to-processed time
+    uint64_t e2e_max_ns;
+    int64_t in_sum;                // |input| sum (gain check)
+    int64_t out_sum;               // |output| sum
+    uint32_t hist[SAMPLE_HIST_BUCKETS];
+};
+
+static struct sample_stats stats;
+
+// =============================================================================
+// INIT TIMING
+// =============================================================================
+
+// The marks bracket the processor's POST_KERNEL init (presets, DT custom
+// properties, validation, pipeline build)
+BUILD_ASSERT(CONFIG_INPUT_PROCESSOR_ACCELERATION_INIT_PRIORITY == 90,
+             "Init marks assume the processor initializes at priority 90");
+
+static uint64_t init_start_ns;
+static uint64_t init_end_ns;
+
+static int sample_init_start(void) {
+    init_start_ns = host_clock_ns();
+    return 0;
+}
+
+static int sample_init_end(void) {
+    init_end_ns = host_clock_ns();
+    return 0;
+}
+
+SYS_INIT(sample_init_start, POST_KERNEL, 89);
+SYS_INIT(sample_init_end, POST_KERNEL, 91);
+
+// =============================================================================
+// LISTENER
+// =============================================================================
+
+static void sample_record(uint64_t proc_ns, uint64_t e2e_ns) {
+    stats.events++;
+    stats.proc_ns += proc_ns;
+    stats.proc_max_ns = MAX(stats.proc_max_ns, proc_ns);
+    stats.e2e_ns += e2e_ns;
+    stats.e2e_max_ns = MAX(stats.e2e_max_ns, e2e_ns);
+
+    uint32_t bucket = 0;
+    while (bucket < SAMPLE_HIST_BUCKETS - 1 && (e2e_ns >> (bucket + 1)) != 0) {
+        bucket++;
+    }
+    stats.hist[bucket]++;
+}
+
+static void sample_listener(struct input_event *evt) {
+    struct input_event event = *evt;
+    struct zmk_input_processor_state state = {0};
+
+    uint64_t start = host_clock_ns();
+    int ret = zmk_input_processor_handle_event(accel, &event, 0, 0, &state);
+    uint64_t end = host_clock_ns();
+
+    if (ret < 0) {
+        stats.errors++;
+    }
+    stats.in_sum += (evt->value < 0) ? -evt->value : evt->value;
+    stats.out_sum += (event.value < 0) ? -event.value : event.value;
+    sample_record(end - start, end - fake_sensor_event_start_ns(sensor));
+}
+
+#if ZEPHYR_VERSION_CODE >= ZEPHYR_VERSION(3, 7, 0)
+static void sample_listener_cb(struct input_event *evt, void *user_data) {
+    ARG_UNUSED(user_data);
+    sample_listener(evt);
+}
+INPUT_CALLBACK_DEFINE(DEVICE_DT_GET(SENSOR_NODE), sample_listener_cb, NULL);
+#else
+INPUT_CALLBACK_DEFINE(DEVICE_DT_GET(SENSOR_NODE), sample_listener);
+#endif
+
+// =============================================================================
+// REPORT
+// =============================================================================
+
+// Upper bound of the bucket holding the given fraction (per mille) of events
+static uint64_t sample_percentile_ns(uint32_t per_mille) {
+    uint64_t target = ((uint64_t)stats.events * per_mille + 999) / 1000;
+    uint64_t seen = 0;
+
+    for (uint32_t b = 0; b < SAMPLE_HIST_BUCKETS; b++) {
+        seen += stats.hist[b];
+        if (seen >= target) {
+            return 1ULL << (b + 1);
+        }
+    }
+    return stats.e2e_max_ns;
+}
+
+static void sample_report(const char *name) {
+    if (stats.events == 0) {
+        printk("%-7s no events\n", name);
+        return;
+    }
+
+    uint64_t proc_avg = stats.proc_ns / stats.events;
+    uint64_t e2e_avg = stats.e2e_ns / stats.events;
+    uint64_t rate = stats.proc_ns ? (uint64_t)stats.events * NSEC_PER_SEC / stats.proc_ns : 0;
+    uint32_t gain = stats.in_sum ? (uint32_t)(stats.out_sum * 1000 / stats.in_sum) : 0;
+
+    printk("%-7s %8u %9llu %9llu %9llu %9llu %9llu %11llu %6u.%03u %u\n", name, stats.events,
+           (unsigned long long)proc_avg, (unsigned long long)stats.proc_max_ns,
+           (unsigned long long)e2e_avg, (unsigned long long)sample_percentile_ns(990),
+           (unsigned long long)stats.e2e_max_ns, (unsigned long long)rate, gain / 1000,
+           gain % 1000, stats.errors);
+}
+
+int main(void) {
+    if (!device_is_ready(accel)) {
+        printk("accel sample: %s failed to initialize\n", accel->name);
+        return 0;
+    }
+    if (!device_is_ready(sensor)) {
+        printk("accel sample: %s failed to initialize\n", sensor->name);
+        return 0;
+    }
+
+    printk("accel sample: level %d, %d reports/phase, processor init %llu ns\n",
+           IS_ENABLED(CONFIG_INPUT_PROCESSOR_ACCEL_LEVEL_STANDARD) ? 2 : 1,
+           CONFIG_ACCEL_SAMPLE_REPORTS, (unsigned long long)(init_end_ns - init_start_ns));
+    printk("%-7s %8s %9s %9s %9s %9s %9s %11s %10s %s\n", "phase", "events", "proc_ns",
+           "proc_max", "e2e_ns", "e2e_p99", "e2e_max", "events/s", "gain", "errors");
+
+    for (int t = 0; t < FAKE_TRAJECTORY_COUNT; t++) {
+        memset(&stats, 0, sizeof(stats));
+        fake_sensor_set_trajectory(sensor, (enum fake_trajectory)t);
+        fake_sensor_emit(sensor, CONFIG_ACCEL_SAMPLE_REPORTS);
+        sample_report(fake_sensor_trajectory_name((enum fake_trajectory)t));
+
+        // Let the speed estimate decay between phases
+        k_sleep(K_MSEC(500));
+    }
+
+    uint32_t counts[ACCEL_LOG_EVENT_COUNT];
+    if (accel_get_event_counts(accel, counts) == 0) {
+        printk("accel sample: guard events");
+        for (int i = 0; i < ACCEL_LOG_EVENT_COUNT; i++) {
+            printk(" %u", counts[i]);
+        }
+        printk("\n");
+    }
+
+    printk("accel sample: done\n");
+    return 0;
+}
@@ -12,44 +12,6 @@
 
 LOG_MODULE_DECLARE(input_processor_accel);
 
-// =============================================================================
-// MEMORY POOL MANAGEMENT
-// =============================================================================
-
-struct accel_data *accel_data_alloc(void) {
-    struct accel_data *data;
-    int ret = k_mem_slab_alloc(&accel_data_pool, (void **)&data, K_NO_WAIT);
-    if (ret == 0 && data != NULL) {
-        // Enhanced safety: Validate allocated pointer before use
-        memset(data, 0, sizeof(struct accel_data));
-        // Initialize with safe default values to prevent issues
-        data->last_time_ms = k_uptime_get_32();
-        data->recent_speed = 0;
-        LOG_DBG("Allocated accel_data from pool: %p", data);
-        return data;
-    }
-    
-    // Enhanced error handling with acceleration-specific error codes
-    if (ret == -ENOMEM) {
-        LOG_ERR("Memory pool exhausted - no available accel_data blocks");
-        // Note: Keep original -ENOMEM for k_mem_slab compatibility, but could map to ACCEL_ERR_NO_MEMORY
-    } else if (ret == -EAGAIN) {
-        LOG_ERR("Memory allocation would block - called from interrupt context");
-        // Note: Keep original -EAGAIN for k_mem_slab compatibility, but could map to ACCEL_ERR_TEMP_UNAVAIL
-    } else {
-        LOG_ERR("Failed to allocate accel_data from pool: %d (ptr=%p)", ret, data);
-    }
-    
-    return NULL;
-}
-
-void accel_data_free(struct accel_data *data) {
-    if (data) {
-        k_mem_slab_free(&accel_data_pool, (void *)data);
-        LOG_DBG("Freed accel_data to pool: %p", data);
-    }
-}
-
 // =============================================================================
 // CONFIGURATION ENCODING/DECODING HELPERS
 // =============================================================================
@@ -61,18 +23,6 @@ uint8_t accel_encode_y_boost(uint16_t y_boost) {
     return (uint8_t)((y_boost - 1000) / 10);
 }
 
-uint8_t accel_encode_sensor_dpi(uint16_t sensor_dpi) {
-    // Encode common DPI values to classes
-    if (sensor_dpi <= 400) return 0;
-    if (sensor_dpi <= 800) return 1;
-    if (sensor_dpi <= 1200) return 2;
-    if (sensor_dpi <= 1600) return 3;
-    if (sensor_dpi <= 3200) return 4;
-    if (sensor_dpi <= 6400) return 5;
-    if (sensor_dpi <= 8000) return 6;
-    return 1; // Default to 800 DPI class
-}
-
 // =============================================================================
 // DEFAULT CONFIGURATIONS
 // =============================================================================
@@ -81,11 +31,16 @@ static const struct accel_config level1_defaults = {
     .level = 1,
     .input_type = INPUT_EV_REL,
     .y_boost_scaled = 0,       // 1.0x (no Y-axis boost)
-    .sensor_dpi_class = 1,     // 800 DPI class
+    .sensor_dpi = STANDARD_DPI_REFERENCE, // 800 DPI (reference)
+    .dpi_sensitivity = ACCEL_DPI_SENSITIVITY(ACCEL_DEFAULT_SENSITIVITY, ACCEL_DPI_SCALE_ONE),
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_TRANSFORM)
+    .transform = {1000, 0, 0, 1000}, // Identity
+    .transform_active = 0,
+#endif
     .cfg.level1 = {
-        .sensitivity = 1000,   // 1.0x (neutral base sensitivity)
-        .max_factor = 2500,    // 2.5x (more noticeable acceleration)
-        .curve_type = 1,       // Mild (smooth acceleration curve)
+        .sensitivity = ACCEL_DEFAULT_SENSITIVITY, // 1.0x (neutral base sensitivity)
+        .max_factor = ACCEL_DEFAULT_MAX_FACTOR,   // 2.5x (more noticeable acceleration)
+        .curve_type = ACCEL_DEFAULT_CURVE_TYPE,   // Mild (smooth acceleration curve)
         .reserved = 0
     }
 };
@@ -94,14 +49,19 @@ static const struct accel_config level2_defaults = {
     .level = 2,
     .input_type = INPUT_EV_REL,
     .y_boost_scaled = 0,       // 1.0x (no Y-axis boost by default)
-    .sensor_dpi_class = 1,     // 800 DPI class
+    .sensor_dpi = STANDARD_DPI_REFERENCE, // 800 DPI (reference)
+    .dpi_sensitivity = ACCEL_DPI_SENSITIVITY(ACCEL_DEFAULT_SENSITIVITY, ACCEL_DPI_SCALE_ONE),
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_TRANSFORM)
+    .transform = {1000, 0, 0, 1000}, // Identity
+    .transform_active = 0,
+#endif
     .cfg.level2 = {
-        .sensitivity = 1000,   // 1.0x (neutral base sensitivity)
-        .max_factor = 2500,    // 2.5x (moderate acceleration for standard level)
-        .min_factor = 900,     // 0.9x (slight precision boost for slow movements)
-        .speed_threshold = 600, // Lower threshold for more responsive acceleration
-        .speed_max = 3500,     // Higher maximum speed for standard level
-        .acceleration_exponent = 2, // Mild exponential curve
+        .sensitivity = ACCEL_DEFAULT_SENSITIVITY, // 1.0x (neutral base sensitivity)
+        .max_factor = ACCEL_DEFAULT_MAX_FACTOR,   // 2.5x (moderate acceleration for standard level)
+        .min_factor = ACCEL_DEFAULT_MIN_FACTOR,   // 0.9x (slight precision boost for slow movements)
+        .speed_threshold = ACCEL_DEFAULT_SPEED_THRESHOLD, // Lower threshold for more responsive acceleration
+        .speed_max = ACCEL_DEFAULT_SPEED_MAX,     // Higher maximum speed for standard level
+        .acceleration_exponent = ACCEL_DEFAULT_EXPONENT, // Mild exponential curve
         .reserved = 0
     }
 };
@@ -13,6 +13,16 @@
 extern "C" {
 #endif
 
+// Level defaults: level1_defaults / level2_defaults, and the devicetree
+// fallbacks of the compile-time configuration (CONFIG_INPUT_PROCESSOR_ACCEL_CONST_CONFIG)
+#define ACCEL_DEFAULT_SENSITIVITY       1000    // 1.0x (neutral base sensitivity)
+#define ACCEL_DEFAULT_MAX_FACTOR        2500    // 2.5x
+#define ACCEL_DEFAULT_CURVE_TYPE        1       // Mild (Level 1)
+#define ACCEL_DEFAULT_MIN_FACTOR        900     // 0.9x (Level 2)
+#define ACCEL_DEFAULT_SPEED_THRESHOLD   DEFAULT_SPEED_THRESHOLD // 600 (Level 2)
+#define ACCEL_DEFAULT_SPEED_MAX         3500    // Level 2
+#define ACCEL_DEFAULT_EXPONENT          2       // Mild exponential (Level 2, also used by presets)
+
 /**
  * @brief Initialize configuration with defaults based on level
  * @param cfg Configuration structure to initialize
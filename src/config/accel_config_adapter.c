@@ -72,39 +72,68 @@ uint16_t accel_get_y_boost(const struct accel_config *cfg) {
 
 uint16_t accel_get_sensor_dpi(const struct accel_config *cfg) {
     if (!cfg) return 800;
-    return accel_decode_sensor_dpi(cfg->sensor_dpi_class);
+    return cfg->sensor_dpi;
 }
 
 // =============================================================================
 // CONFIGURATION SETTER FUNCTIONS
 // =============================================================================
 
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_BUDGET)
+// Marks the latency-budget table stale; the next event rebuilds it. Bumped
+// after the fields are written, so a rebuild never keeps a half-updated curve
+#define ACCEL_CONFIG_CHANGED(cfg) ((cfg)->budget_epoch++)
+#else
+#define ACCEL_CONFIG_CHANGED(cfg) ((void)(cfg))
+#endif
+
 void accel_set_sensitivity(struct accel_config *cfg, uint16_t sensitivity) {
     if (!cfg) return;
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_FAST_PATH)
+    // Stay inside the domain the fast path was verified on
+    sensitivity = ACCEL_CLAMP(sensitivity, SENSITIVITY_MIN, SENSITIVITY_MAX);
+#endif
     
     if (cfg->level == 1) {
         cfg->cfg.level1.sensitivity = sensitivity;
     } else {
         cfg->cfg.level2.sensitivity = sensitivity;
     }
+    cfg->dpi_sensitivity = calculate_dpi_adjusted_sensitivity(cfg);
+    ACCEL_CONFIG_CHANGED(cfg);
 }
 
 void accel_set_max_factor(struct accel_config *cfg, uint16_t max_factor) {
     if (!cfg) return;
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_FAST_PATH)
+    // Level 2 also needs max_factor >= min_factor
+    uint16_t lower = (cfg->level == 2) ? MAX(cfg->cfg.level2.min_factor, MAX_FACTOR_MIN) :
+        MAX_FACTOR_MIN;
+    max_factor = ACCEL_CLAMP(max_factor, lower, MAX_FACTOR_MAX);
+#endif
     
     if (cfg->level == 1) {
         cfg->cfg.level1.max_factor = max_factor;
     } else {
         cfg->cfg.level2.max_factor = max_factor;
     }
+    ACCEL_CONFIG_CHANGED(cfg);
 }
 
 void accel_set_y_boost(struct accel_config *cfg, uint16_t y_boost) {
     if (!cfg) return;
     cfg->y_boost_scaled = accel_encode_y_boost(y_boost);
+    ACCEL_CONFIG_CHANGED(cfg);
 }
 
 void accel_set_sensor_dpi(struct accel_config *cfg, uint16_t sensor_dpi) {
     if (!cfg) return;
-    cfg->sensor_dpi_class = accel_encode_sensor_dpi(sensor_dpi);
+    sensor_dpi = ACCEL_CLAMP(sensor_dpi, SENSOR_DPI_MIN, SENSOR_DPI_MAX);
+    cfg->sensor_dpi = sensor_dpi;
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_WIDE_RANGE)
+    cfg->prescale_q16 = ACCEL_PRESCALE_Q16(sensor_dpi);
+#endif
+    // The handler only reads the result; no per-event division or lock
+    cfg->dpi_sensitivity = calculate_dpi_adjusted_sensitivity(cfg);
+    ACCEL_CONFIG_CHANGED(cfg);
 }
\ No newline at end of file
@@ -44,12 +44,12 @@ void accel_log_final_config(const struct accel_config *cfg, uint8_t config_level
 
     if (config_level == 1) {
         uint16_t y_boost = accel_decode_y_boost(cfg->y_boost_scaled);
-        uint16_t sensor_dpi = accel_decode_sensor_dpi(cfg->sensor_dpi_class);
+        uint16_t sensor_dpi = cfg->sensor_dpi;
         LOG_INF("Final Level 1 config: sens=%u, max=%u, curve=%u, y_boost=%u, dpi=%u",
                 cfg->cfg.level1.sensitivity, cfg->cfg.level1.max_factor, cfg->cfg.level1.curve_type, y_boost, sensor_dpi);
     } else {
         uint16_t y_boost = accel_decode_y_boost(cfg->y_boost_scaled);
-        uint16_t sensor_dpi = accel_decode_sensor_dpi(cfg->sensor_dpi_class);
+        uint16_t sensor_dpi = cfg->sensor_dpi;
         LOG_INF("Final Level 2 config: sens=%u, max=%u, thresh=%u, max_speed=%u, min=%u, exp=%u, y_boost=%u, dpi=%u",
                 cfg->cfg.level2.sensitivity, cfg->cfg.level2.max_factor,
                 cfg->cfg.level2.speed_threshold, cfg->cfg.level2.speed_max, cfg->cfg.level2.min_factor, cfg->cfg.level2.acceleration_exponent, y_boost, sensor_dpi);
@@ -0,0 +1,150 @@
+// input_processor_accel_budget.c - Per-event latency budget watchdog
+// Repeated cycle-budget overruns switch Level 2 to a precomputed table
+//
+// Copyright (c) 2024 The ZMK Contributors
+// Modifications (c) 2025 NUOVOTAKA
+// SPDX-License-Identifier: MIT
+
+#include <zephyr/logging/log.h>
+#include <zephyr/kernel.h>
+#include <zephyr/input/input.h>
+#include <stdlib.h>
+#include "../include/drivers/input_processor_accel.h"
+
+LOG_MODULE_DECLARE(input_processor_accel);
+
+#define ACCEL_BUDGET_CYCLES   CONFIG_INPUT_PROCESSOR_ACCEL_BUDGET_CYCLES
+#define ACCEL_BUDGET_OVERRUNS CONFIG_INPUT_PROCESSOR_ACCEL_BUDGET_OVERRUNS
+
+// Reports per second the presets are tuned for (125 Hz)
+#define ACCEL_BUDGET_REFERENCE_RATE (1000000U / ACCEL_RATE_REFERENCE_US)
+
+// =============================================================================
+// FAST PATH TABLE
+// =============================================================================
+
+void accel_budget_build_lut(const struct accel_config *cfg, struct accel_data *data) {
+    uint32_t sensitivity = accel_get_dpi_sensitivity(cfg);
+
+    // Level 2 curve sampled at the reference report rate: an input of n
+    // counts per report stands for a speed of n * 125 counts/s
+    for (int i = 0; i < ACCEL_BUDGET_LUT_SIZE; i++) {
+        uint32_t factor = accel_standard_speed_factor(cfg, (uint32_t)i * ACCEL_BUDGET_REFERENCE_RATE);
+        int64_t value = (int64_t)i * sensitivity / SENSITIVITY_SCALE;
+        value = value * factor / SENSITIVITY_SCALE;
+        data->budget_lut[i] = (int16_t)ACCEL_CLAMP(value, 0, INT16_MAX);
+    }
+    data->budget_lut_epoch = cfg->budget_epoch;
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_LAZY_STATE)
+    data->budget_lut_ready = 1;
+#endif
+}
+
+int32_t accel_budget_lut_calculate(const struct accel_config *cfg, struct accel_data *data,
+                                   int32_t input_value, uint16_t code) {
+    int32_t abs_input = abs(input_value);
+
+    // Same input limits as the full Level 2 path
+    if (abs_input > MAX_EXTREME_INPUT) {
+        return 0;
+    }
+    abs_input = MIN(abs_input, MAX_REASONABLE_INPUT);
+
+    // Keep speed tracking current: probes and the switch back to the full
+    // path must not start from the speed at the time of degrading
+    accel_calculate_simple_speed(data, abs_input);
+
+    // Beyond the table the last entry's gain is extended linearly
+    int32_t result = (abs_input < ACCEL_BUDGET_LUT_SIZE) ? data->budget_lut[abs_input] :
+        (int32_t)((int64_t)abs_input * data->budget_lut[ACCEL_BUDGET_LUT_SIZE - 1] /
+                  (ACCEL_BUDGET_LUT_SIZE - 1));
+
+    if (code == INPUT_REL_Y) {
+        uint16_t y_boost = accel_decode_y_boost(cfg->y_boost_scaled);
+        result = result * (int32_t)ACCEL_CLAMP(y_boost, 500, 3000) / SENSITIVITY_SCALE;
+    }
+
+    result = MIN(result, INT16_MAX);
+    return (input_value < 0) ? -result : result;
+}
+
+// =============================================================================
+// WATCHDOG
+// =============================================================================
+
+/**
+ * @brief Update the overrun state after a measured event
+ * LUT-path events say nothing about the full path's cost and only count.
+ */
+static void accel_budget_account(struct accel_data *data, uint32_t cycles) {
+    if (cycles > data->budget_max_cycles) {
+        data->budget_max_cycles = cycles;
+    }
+
+    if (data->budget_fast) {
+        data->budget_fast_events++;
+        return;
+    }
+
+    if (cycles > ACCEL_BUDGET_CYCLES) {
+        data->budget_overruns++;
+        data->budget_ok_streak = 0;
+        if (!data->budget_degraded && ++data->budget_over_streak >= ACCEL_BUDGET_OVERRUNS) {
+            data->budget_degraded = 1;
+            data->budget_over_streak = 0;
+            data->budget_probe_count = 0;
+            data->budget_degradations++;
+        }
+    } else {
+        data->budget_over_streak = 0;
+        if (data->budget_degraded && ++data->budget_ok_streak >= ACCEL_BUDGET_OVERRUNS) {
+            data->budget_degraded = 0;
+            data->budget_ok_streak = 0;
+        }
+    }
+}
+
+int32_t accel_budget_run(const struct accel_config *cfg, struct accel_data *data,
+                         uint16_t code, int32_t value, bool sync) {
+    // Table deferred from boot or outdated by a setter; rebuilt outside the
+    // measured window
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_LAZY_STATE)
+    if (unlikely(!data->budget_lut_ready || data->budget_lut_epoch != cfg->budget_epoch)) {
+#else
+    if (unlikely(data->budget_lut_epoch != cfg->budget_epoch)) {
+#endif
+        accel_budget_build_lut(cfg, data);
+    }
+
+    // While degraded, every ACCEL_BUDGET_PROBE_INTERVAL-th event probes the full path
+    data->budget_fast = 0;
+    if (data->budget_degraded) {
+        if (++data->budget_probe_count >= ACCEL_BUDGET_PROBE_INTERVAL) {
+            data->budget_probe_count = 0;
+        } else {
+            data->budget_fast = 1;
+        }
+    }
+
+    uint32_t start = k_cycle_get_32();
+    int32_t result = accel_pipeline_run(cfg, data, code, value, sync);
+    accel_budget_account(data, k_cycle_get_32() - start);
+
+    return result;
+}
+
+int accel_budget_get_stats(const struct device *dev, struct accel_budget_stats *stats) {
+    if (!dev || !dev->data || !stats) {
+        return ACCEL_ERR_INVALID_ARG;
+    }
+    const struct accel_data *data = dev->data;
+
+    unsigned int key = irq_lock();
+    stats->overruns = data->budget_overruns;
+    stats->degradations = data->budget_degradations;
+    stats->fast_events = data->budget_fast_events;
+    stats->max_cycles = data->budget_max_cycles;
+    stats->degraded = data->budget_degraded;
+    irq_unlock(key);
+    return 0;
+}
@@ -19,18 +19,14 @@ LOG_MODULE_DECLARE(input_processor_accel);
 int64_t safe_multiply_64(int64_t a, int64_t b, int64_t max_result) {
     if (a == 0 || b == 0) return 0;
     
+    // Magnitudes in unsigned arithmetic: -INT64_MIN is not representable
+    uint64_t abs_a = (a < 0) ? 0 - (uint64_t)a : (uint64_t)a;
+    uint64_t abs_b = (b < 0) ? 0 - (uint64_t)b : (uint64_t)b;
+    bool negative = (a < 0) != (b < 0);
+    
     // Enhanced safety: More robust overflow detection
-    if (a > 0 && b > 0) {
-        if (a > max_result / b) return max_result;
-    } else if (a < 0 && b < 0) {
-        // Both negative: result is positive
-        if ((-a) > max_result / (-b)) return max_result;
-    } else if (a < 0 && b > 0) {
-        // a negative, b positive: result is negative
-        if ((-a) > max_result / b) return -max_result;
-    } else if (a > 0 && b < 0) {
-        // a positive, b negative: result is negative
-        if (a > max_result / (-b)) return -max_result;
+    if (abs_a > (uint64_t)max_result / abs_b) {
+        return negative ? -max_result : max_result;
     }
     
     return a * b;
@@ -58,61 +54,23 @@ uint32_t calculate_dpi_adjusted_sensitivity(const struct accel_config *cfg) {
         return SENSITIVITY_SCALE; // Graceful degradation: return neutral sensitivity
     }
     
-    uint32_t dpi_adjusted_sensitivity;
+    // Get sensitivity based on level
+    uint16_t sensitivity = (cfg->level == 1) ? cfg->cfg.level1.sensitivity : cfg->cfg.level2.sensitivity;
     
-    uint16_t sensor_dpi = accel_decode_sensor_dpi(cfg->sensor_dpi_class);
-    if (sensor_dpi > 0 && sensor_dpi <= MAX_SENSOR_DPI) {
-        // Get sensitivity based on level
-        uint16_t sensitivity = (cfg->level == 1) ? cfg->cfg.level1.sensitivity : cfg->cfg.level2.sensitivity;
-        
-        // Improved DPI scaling using 64-bit arithmetic for precision
-        if (sensor_dpi > STANDARD_DPI_REFERENCE) {
-            // High DPI sensor: reduce sensitivity with precise calculation
-            uint64_t temp = (uint64_t)sensitivity * STANDARD_DPI_REFERENCE;
-            dpi_adjusted_sensitivity = (uint32_t)(temp / sensor_dpi);
-            
-            // Apply conservative limits to prevent extreme reduction
-            uint32_t min_allowed = sensitivity / FALLBACK_MAX_REDUCTION; // Max reduction
-            if (dpi_adjusted_sensitivity < min_allowed) {
-                dpi_adjusted_sensitivity = min_allowed;
-            }
-            
-            // Ensure minimum sensitivity
-            if (dpi_adjusted_sensitivity < MIN_SAFE_SENSITIVITY) {
-                dpi_adjusted_sensitivity = MIN_SAFE_SENSITIVITY;
-            }
-        } else if (sensor_dpi < STANDARD_DPI_REFERENCE) {
-            // Low DPI sensor: increase sensitivity with precise calculation
-            uint64_t temp = (uint64_t)sensitivity * STANDARD_DPI_REFERENCE;
-            dpi_adjusted_sensitivity = (uint32_t)(temp / sensor_dpi);
-            
-            // Apply conservative limits to prevent extreme increase
-            uint32_t max_allowed = sensitivity * FALLBACK_MAX_INCREASE; // Max increase
-            if (dpi_adjusted_sensitivity > max_allowed) {
-                dpi_adjusted_sensitivity = max_allowed;
-            }
-            
-            // Ensure maximum sensitivity
-            if (dpi_adjusted_sensitivity > MAX_SAFE_SENSITIVITY) {
-                dpi_adjusted_sensitivity = MAX_SAFE_SENSITIVITY;
-            }
-        } else {
-            // Standard DPI: use as-is
-            dpi_adjusted_sensitivity = sensitivity;
-        }
-        
-        LOG_DBG("DPI adjustment: %u DPI, sensitivity %u -> %u (precise calc)", 
-                sensor_dpi, sensitivity, dpi_adjusted_sensitivity);
+    // Q16 STANDARD_DPI_REFERENCE / sensor_dpi; runs in the setters, not per event
+    uint32_t dpi_scale = ACCEL_DPI_SCALE_ONE;
+    if (cfg->sensor_dpi != 0) {
+        dpi_scale = ACCEL_DPI_SCALE_Q16(ACCEL_ADJUST_DPI(cfg->sensor_dpi));
     } else {
-        // Invalid or missing DPI: use original sensitivity
-        uint16_t sensitivity = (cfg->level == 1) ? cfg->cfg.level1.sensitivity : cfg->cfg.level2.sensitivity;
-        dpi_adjusted_sensitivity = sensitivity;
-        LOG_WRN("Invalid sensor DPI %u, using original sensitivity %u", 
-                sensor_dpi, sensitivity);
+        // Missing DPI: use original sensitivity
+        accel_log_event(cfg, ACCEL_LOG_INVALID_CONFIG);
     }
     
-    // Final safety clamp
-    dpi_adjusted_sensitivity = ACCEL_CLAMP(dpi_adjusted_sensitivity, MIN_SAFE_SENSITIVITY, MAX_SAFE_SENSITIVITY);
+    // High DPI reduces, low DPI raises the sensitivity, within conservative limits
+    uint32_t dpi_adjusted_sensitivity = ACCEL_DPI_SENSITIVITY(sensitivity, dpi_scale);
+    
+    LOG_DBG("DPI adjustment: %u DPI, sensitivity %u -> %u", 
+            cfg->sensor_dpi, sensitivity, dpi_adjusted_sensitivity);
     return dpi_adjusted_sensitivity;
 }
 
@@ -126,6 +84,10 @@ uint32_t calculate_exponential_curve(uint32_t t, uint8_t exponent) {
     if (t > SPEED_NORMALIZATION) {
         t = SPEED_NORMALIZATION;
     }
+    // Every curve starts at 0 (the cubic overflow checks below divide by t)
+    if (t == 0) {
+        return 0;
+    }
     
     switch (exponent) {
         case 1: // Linear
@@ -137,7 +99,7 @@ uint32_t calculate_exponential_curve(uint32_t t, uint8_t exponent) {
                 uint32_t quad = (t_sq > CURVE_MILD_DIVISOR * UINT32_MAX) ? 
                     UINT32_MAX : (uint32_t)(t_sq / CURVE_MILD_DIVISOR);
                 uint32_t result = (t > UINT32_MAX - quad) ? UINT32_MAX : t + quad;
-                return ACCEL_CLAMP(result, 0, SPEED_NORMALIZATION * 2);
+                return MIN(result, SPEED_NORMALIZATION * 2);
             }
             
         case 3: // Moderate exponential
@@ -150,7 +112,7 @@ uint32_t calculate_exponential_curve(uint32_t t, uint8_t exponent) {
                     UINT32_MAX : (uint32_t)(t_cb / CURVE_MODERATE_CUBIC_DIV);
                 uint64_t temp_result = (uint64_t)t + quad + cubic;
                 uint32_t result = (temp_result > UINT32_MAX) ? UINT32_MAX : (uint32_t)temp_result;
-                return ACCEL_CLAMP(result, 0, SPEED_NORMALIZATION * 3);
+                return MIN(result, SPEED_NORMALIZATION * 3);
             }
             
         case 4: // Strong exponential
@@ -163,7 +125,7 @@ uint32_t calculate_exponential_curve(uint32_t t, uint8_t exponent) {
                     UINT32_MAX : (uint32_t)(t_cb / CURVE_STRONG_CUBIC_DIV);
                 uint64_t temp_result = (uint64_t)t + quad + cubic;
                 uint32_t result = (temp_result > UINT32_MAX) ? UINT32_MAX : (uint32_t)temp_result;
-                return ACCEL_CLAMP(result, 0, SPEED_NORMALIZATION * 4);
+                return MIN(result, SPEED_NORMALIZATION * 4);
             }
             
         case 5: // Aggressive exponential
@@ -176,7 +138,7 @@ uint32_t calculate_exponential_curve(uint32_t t, uint8_t exponent) {
                     UINT32_MAX : (uint32_t)(t_cb / CURVE_AGGRESSIVE_CUBIC_DIV);
                 uint64_t temp_result = (uint64_t)t + quad + cubic;
                 uint32_t result = (temp_result > UINT32_MAX) ? UINT32_MAX : (uint32_t)temp_result;
-                return ACCEL_CLAMP(result, 0, SPEED_NORMALIZATION * 5);
+                return MIN(result, SPEED_NORMALIZATION * 5);
             }
             
         default: // Fallback quadratic
@@ -184,7 +146,7 @@ uint32_t calculate_exponential_curve(uint32_t t, uint8_t exponent) {
                 uint64_t t_sq = (uint64_t)t * t;
                 uint32_t result = (t_sq > CURVE_DEFAULT_DIVISOR * UINT32_MAX) ? 
                     UINT32_MAX : (uint32_t)(t_sq / CURVE_DEFAULT_DIVISOR);
-                return ACCEL_CLAMP(result, 0, SPEED_NORMALIZATION);
+                return MIN(result, SPEED_NORMALIZATION);
             }
     }
 }
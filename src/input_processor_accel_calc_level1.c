@@ -16,15 +16,52 @@ LOG_MODULE_DECLARE(input_processor_accel);
 // LEVEL 1 CALCULATION FUNCTION
 // =============================================================================
 
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_LEVEL_SIMPLE)
+/**
+ * @brief Level 1 curve factor for an input magnitude
+ * @param cfg Acceleration configuration
+ * @param abs_input Absolute input value (2..MAX_SAFE_INPUT_VALUE)
+ * @return Factor to apply (thousandths, SENSITIVITY_SCALE..max_factor)
+ */
+uint32_t accel_simple_curve_factor(const struct accel_config *cfg, int32_t abs_input) {
+    uint32_t max_factor = cfg->cfg.level1.max_factor;
+    uint8_t curve_type = cfg->cfg.level1.curve_type;
+    uint32_t input = (uint32_t)abs_input;
+
+    // Enhanced safety: Validate max_factor before use
+    if (ACCEL_GUARD(max_factor < SENSITIVITY_SCALE || max_factor > MAX_SAFE_FACTOR)) {
+        max_factor = ACCEL_CLAMP(max_factor, SENSITIVITY_SCALE, MAX_SAFE_FACTOR);
+    }
+    // Beyond the curve's domain every curve has reached max_factor
+    if (ACCEL_GUARD(abs_input < 0 || abs_input > MAX_SAFE_INPUT_VALUE)) {
+        return max_factor;
+    }
+    uint32_t max_add = max_factor - SENSITIVITY_SCALE;
+    uint32_t add;
+
+    // input <= 2000, so input^2 * 50 fits in 32 bits
+    switch (curve_type) {
+    case 0: // Linear
+        add = input * LINEAR_CURVE_MULTIPLIER;
+        break;
+    case 2: // Strong quadratic
+        add = input * input * CURVE_STRONG_QUAD_NUMERATOR / CURVE_STRONG_QUAD_DENOMINATOR;
+        break;
+    default: // Mild quadratic (also the safe fallback for an invalid curve type)
+        add = input * input * CURVE_MILD_QUAD_NUMERATOR / CURVE_MILD_QUAD_DENOMINATOR;
+        break;
+    }
+    return SENSITIVITY_SCALE + MIN(add, max_add);
+}
+#endif // CONFIG_INPUT_PROCESSOR_ACCEL_LEVEL_SIMPLE
+
 int32_t accel_simple_calculate(const struct accel_config *cfg, int32_t input_value, uint16_t code) {
-    if (!cfg) {
-        LOG_ERR("Configuration pointer is NULL in simple calculation");
+    ARG_UNUSED(code); // Trace events only
+    if (ACCEL_GUARD(!cfg)) {
         return input_value; // Graceful degradation: return original value
     }
 
 #if !defined(CONFIG_INPUT_PROCESSOR_ACCEL_LEVEL_SIMPLE)
-    LOG_DBG("Simple level not enabled, using fallback calculation for input: %d", input_value);
-    
     // Enhanced safety: Input value validation
     input_value = accel_clamp_input_value(input_value);
     
@@ -46,9 +83,6 @@ int32_t accel_simple_calculate(const struct accel_config *cfg, int32_t input_val
     // Final scaling
     result = result / 1000;
     
-    LOG_DBG("Fallback calculation: %d -> sensitivity=%lld -> final=%lld", 
-            input_value, (int64_t)input_value * 1000, result);
-    
     int32_t safe_result = safe_int64_to_int32(result);
     return safe_int32_to_int16(safe_result);
 #else
@@ -56,31 +90,29 @@ int32_t accel_simple_calculate(const struct accel_config *cfg, int32_t input_val
     if (abs(input_value) > MAX_REASONABLE_INPUT) {
         if (abs(input_value) > MAX_EXTREME_INPUT) {
             // Extremely large values are likely sensor noise or malicious input
-            LOG_WRN("Level1: Input value %d too extreme (>%d), rejecting for safety", 
-                    input_value, MAX_EXTREME_INPUT);
+            accel_log_event(cfg, ACCEL_LOG_INPUT_REJECTED);
             return 0;
         } else {
-            // Large but reasonable values - clamp to limit with warning
-            LOG_DBG("Level1: Input value %d clamped to %d for safety", 
-                    input_value, MAX_REASONABLE_INPUT);
+            // Large but reasonable values - clamp to limit
             input_value = (input_value > 0) ? MAX_REASONABLE_INPUT : -MAX_REASONABLE_INPUT;
         }
     }
     
     // Enhanced safety: Configuration validation
-    if (cfg->cfg.level1.sensitivity == 0 || cfg->cfg.level1.sensitivity > MAX_SAFE_SENSITIVITY) {
-        LOG_ERR("Level1: Invalid sensitivity %u, using default", cfg->cfg.level1.sensitivity);
+    if (ACCEL_GUARD(cfg->cfg.level1.sensitivity == 0 ||
+                    cfg->cfg.level1.sensitivity > MAX_SAFE_SENSITIVITY)) {
+        accel_log_event(cfg, ACCEL_LOG_INVALID_CONFIG);
         return input_value; // Safe fallback
     }
     
-    uint32_t dpi_adjusted_sensitivity = calculate_dpi_adjusted_sensitivity(cfg);
+    uint32_t dpi_adjusted_sensitivity = accel_get_dpi_sensitivity(cfg);
     
     // Calculate DPI-adjusted sensitivity
     
     // Enhanced safety: Check sensitivity bounds
-    if (dpi_adjusted_sensitivity == 0 || dpi_adjusted_sensitivity > MAX_SAFE_SENSITIVITY) {
-        LOG_ERR("Level1: Invalid DPI-adjusted sensitivity %u, using passthrough", 
-                dpi_adjusted_sensitivity);
+    if (ACCEL_GUARD(dpi_adjusted_sensitivity == 0 ||
+                    dpi_adjusted_sensitivity > MAX_SAFE_SENSITIVITY)) {
+        accel_log_event(cfg, ACCEL_LOG_INVALID_CONFIG);
         return input_value;
     }
     
@@ -89,8 +121,8 @@ int32_t accel_simple_calculate(const struct accel_config *cfg, int32_t input_val
     
     // Enhanced safety: Use 64-bit safe comparison for overflow detection
     const int64_t max_safe_input = INT64_MAX / dpi_adjusted_sensitivity;
-    if (abs(input_value) > max_safe_input) {
-        LOG_WRN("Level1: Potential overflow detected, using safe calculation");
+    if (ACCEL_GUARD(abs(input_value) > max_safe_input)) {
+        accel_log_event(cfg, ACCEL_LOG_OVERFLOW);
         // Use safe multiplication with proper 64-bit limits
         result = safe_multiply_64((int64_t)input_value, (int64_t)dpi_adjusted_sensitivity, 
                                  (int64_t)INT32_MAX * SENSITIVITY_SCALE);
@@ -98,16 +130,10 @@ int32_t accel_simple_calculate(const struct accel_config *cfg, int32_t input_val
         result = (int64_t)input_value * (int64_t)dpi_adjusted_sensitivity;
     }
     
-    #if defined(CONFIG_INPUT_PROCESSOR_ACCEL_DEBUG_LOG)
-    LOG_DBG("Level1: input=%d * adj_sens=%u = raw_result=%lld", 
-            input_value, dpi_adjusted_sensitivity, result);
-    #endif
-    
     // Enhanced safety: Comprehensive intermediate result validation
     const int64_t max_intermediate = (int64_t)INT16_MAX * SENSITIVITY_SCALE;
-    if (abs(result) > max_intermediate) {
-        LOG_WRN("Level1: Intermediate result %lld exceeds safe limit %lld, clamping", 
-                result, max_intermediate);
+    if (ACCEL_GUARD(llabs(result) > max_intermediate)) {
+        accel_log_event(cfg, ACCEL_LOG_OVERFLOW);
         result = (result > 0) ? max_intermediate : -max_intermediate;
     }
     
@@ -116,92 +142,32 @@ int32_t accel_simple_calculate(const struct accel_config *cfg, int32_t input_val
         result = result / SENSITIVITY_SCALE;
         
         // Final safety check after scaling
-        if (abs(result) > INT16_MAX) {
-            LOG_WRN("Level1: Scaled result %lld exceeds int16 range, clamping", result);
+        if (ACCEL_GUARD(llabs(result) > INT16_MAX)) {
+            accel_log_event(cfg, ACCEL_LOG_CLAMPED);
             result = (result > 0) ? INT16_MAX : INT16_MIN;
         }
     }
     
     // Level 1 curve processing
     int32_t abs_input = abs(input_value);
+    uint32_t curve_factor = SENSITIVITY_SCALE;
     
     if (abs_input > 1 && abs_input <= MAX_SAFE_INPUT_VALUE) {
-        uint32_t curve_factor = SENSITIVITY_SCALE; // Start with 1.0x
-        
-        // Enhanced safety: Validate max_factor before use
-        uint32_t safe_max_factor = ACCEL_CLAMP(cfg->cfg.level1.max_factor, SENSITIVITY_SCALE, MAX_SAFE_FACTOR);
-        
-        // Enhanced safety: Validate curve_type with bounds checking
-        uint8_t safe_curve_type = (cfg->cfg.level1.curve_type < 3) ? cfg->cfg.level1.curve_type : 1;
-        
-        switch (safe_curve_type) {
-            case 0: // Linear - Enhanced safety
-                {
-                    uint64_t linear_add = safe_multiply_64((int64_t)abs_input, 
-                                                         (int64_t)LINEAR_CURVE_MULTIPLIER, 
-                                                         (int64_t)UINT32_MAX);
-                    uint32_t max_add = (safe_max_factor > SENSITIVITY_SCALE) ? 
-                        safe_max_factor - SENSITIVITY_SCALE : 0;
-                    if (linear_add > max_add) {
-                        linear_add = max_add;
-                    }
-                    curve_factor = SENSITIVITY_SCALE + (uint32_t)linear_add;
-                }
-                break;
-            case 1: // Mild - Improved quadratic approximation
-                {
-                    // More effective calculation: input^2 * multiplier / divisor
-                    uint64_t quad_add = safe_multiply_64((int64_t)abs_input * abs_input, 
-                                                       CURVE_MILD_QUAD_NUMERATOR, (int64_t)UINT32_MAX);
-                    quad_add = quad_add / CURVE_MILD_QUAD_DENOMINATOR; // Scale down
-                    uint32_t max_add = (safe_max_factor > SENSITIVITY_SCALE) ? 
-                        safe_max_factor - SENSITIVITY_SCALE : 0;
-                    curve_factor = SENSITIVITY_SCALE + ACCEL_CLAMP((uint32_t)quad_add, 0, max_add);
-                    
-                    // Debug log for curve calculation
-                    LOG_DBG("Level1 Mild: input=%d, quad_add=%llu, curve_factor=%u", 
-                            abs_input, quad_add, curve_factor);
-                }
-                break;
-            case 2: // Strong - Improved quadratic approximation
-                {
-                    // More aggressive calculation for strong curve
-                    uint64_t quad_add = safe_multiply_64((int64_t)abs_input * abs_input, 
-                                                       CURVE_STRONG_QUAD_NUMERATOR, (int64_t)UINT32_MAX);
-                    quad_add = quad_add / CURVE_STRONG_QUAD_DENOMINATOR; // Scale down
-                    uint32_t max_add = (safe_max_factor > SENSITIVITY_SCALE) ? 
-                        safe_max_factor - SENSITIVITY_SCALE : 0;
-                    curve_factor = SENSITIVITY_SCALE + ACCEL_CLAMP((uint32_t)quad_add, 0, max_add);
-                    
-                    // Debug log for curve calculation
-                    LOG_DBG("Level1 Strong: input=%d, quad_add=%llu, curve_factor=%u", 
-                            abs_input, quad_add, curve_factor);
-                }
-                break;
-            default: // Safe fallback
-                {
-                    uint64_t default_add = safe_multiply_64((int64_t)abs_input, 
-                                                          (int64_t)LINEAR_CURVE_MULTIPLIER, 
-                                                          (int64_t)UINT32_MAX);
-                    uint32_t max_add = (safe_max_factor > SENSITIVITY_SCALE) ? 
-                        safe_max_factor - SENSITIVITY_SCALE : 0;
-                    curve_factor = SENSITIVITY_SCALE + ACCEL_CLAMP((uint32_t)default_add, 0, max_add);
-                }
-                break;
-        }
-        
-        // Enhanced safety: Double-check curve factor bounds
-        curve_factor = ACCEL_CLAMP(curve_factor, SENSITIVITY_SCALE, safe_max_factor);
+        ACCEL_TRACE(cfg, "curve_start", code, abs_input);
+        curve_factor = accel_simple_curve_factor(cfg, abs_input);
+        ACCEL_TRACE(cfg, "curve_end", code, curve_factor);
         
         if (curve_factor > SENSITIVITY_SCALE) {
-            int64_t temp_result = safe_multiply_64(result, (int64_t)curve_factor, 
-                                                 (int64_t)INT16_MAX * SENSITIVITY_SCALE);
+            // Saturating multiply only where the product could exceed the limit
+            const int64_t max_product = (int64_t)INT16_MAX * SENSITIVITY_SCALE;
+            int64_t temp_result = ACCEL_GUARD(llabs(result) > max_product / curve_factor) ?
+                safe_multiply_64(result, (int64_t)curve_factor, max_product) :
+                result * (int64_t)curve_factor;
             result = temp_result / SENSITIVITY_SCALE;
             
             // Enhanced safety: Multiple range checks for Level 1 result
-            if (abs(result) > INT16_MAX) {
-                LOG_WRN("Level1: Result %lld exceeds int16 range, clamping to %d", 
-                        result, INT16_MAX);
+            if (ACCEL_GUARD(llabs(result) > INT16_MAX)) {
+                accel_log_event(cfg, ACCEL_LOG_CLAMPED);
                 result = (result > 0) ? INT16_MAX : INT16_MIN;
             }
         }
@@ -213,13 +179,11 @@ int32_t accel_simple_calculate(const struct accel_config *cfg, int32_t input_val
         int64_t raw_result = (int64_t)input_value * (int64_t)dpi_adjusted_sensitivity;
         
         // Only output movement if the raw calculation was >= 0.5 (half of SENSITIVITY_SCALE)
-        if (abs(raw_result) >= SENSITIVITY_SCALE / CONSERVATIVE_FALLBACK_MULTIPLIER) {
+        if (llabs(raw_result) >= SENSITIVITY_SCALE / CONSERVATIVE_FALLBACK_MULTIPLIER) {
             result = (raw_result > 0) ? 1 : -1;
-            LOG_DBG("Level1: Minimum movement applied - raw=%lld -> output=%lld", raw_result, result);
         } else {
             // Raw calculation was < 0.5, legitimately should be 0
             result = 0;
-            LOG_DBG("Level1: Micro movement ignored - raw=%lld (< 0.5 threshold)", raw_result);
         }
     }
     
@@ -227,20 +191,22 @@ int32_t accel_simple_calculate(const struct accel_config *cfg, int32_t input_val
     int32_t safe_result = safe_int64_to_int32(result);
     int16_t final_result = safe_int32_to_int16(safe_result);
     
-    // Enhanced safety: Final bounds check with logging
-    if (abs(final_result) > INT16_MAX) {
-        LOG_ERR("Level1: Final result %d exceeds int16 bounds, emergency clamp", final_result);
+    // Enhanced safety: Final bounds check
+    if (ACCEL_GUARD(abs(final_result) > INT16_MAX)) {
+        accel_log_event(cfg, ACCEL_LOG_CLAMPED);
         final_result = (final_result > 0) ? INT16_MAX : INT16_MIN;
     }
     
     // Enhanced safety: Sanity check - if input was reasonable, output should be too
-    if (abs(input_value) <= 100 && abs(final_result) > 1000) {
-        LOG_WRN("Level1: Suspicious result %d for input %d, using conservative value", 
-                final_result, input_value);
+    if (ACCEL_GUARD(abs(input_value) <= 100 && abs(final_result) > 1000)) {
+        accel_log_event(cfg, ACCEL_LOG_SUSPICIOUS);
         final_result = input_value * CONSERVATIVE_FALLBACK_MULTIPLIER; // Conservative fallback
         final_result = safe_int32_to_int16(final_result);
     }
     
+    // Latest calculation for the periodic summary (debug builds only)
+    accel_log_debug(cfg, input_value, 0, curve_factor, final_result);
+    
     return final_result;
 #endif
 }
\ No newline at end of file
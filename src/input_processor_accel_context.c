@@ -0,0 +1,89 @@
+// input_processor_accel_context.c - Runtime-created acceleration contexts
+// Independent runtime state from a fixed slab, sharing a device's config
+//
+// Copyright (c) 2024 The ZMK Contributors
+// Modifications (c) 2025 NUOVOTAKA
+// SPDX-License-Identifier: MIT
+
+#include <zephyr/logging/log.h>
+#include <zephyr/kernel.h>
+#include <zephyr/input/input.h>
+#include <string.h>
+#include <drivers/input_processor.h>
+#include "../include/drivers/input_processor_accel.h"
+
+LOG_MODULE_DECLARE(input_processor_accel);
+
+// Fixed-size blocks with an intrusive free list: allocation and release are
+// O(1) and never fragment
+K_MEM_SLAB_DEFINE_STATIC(accel_context_slab, sizeof(struct accel_context),
+                         CONFIG_INPUT_PROCESSOR_ACCEL_CONTEXT_COUNT,
+                         MAX(ACCEL_DATA_POOL_ALIGNMENT, __alignof__(struct accel_context)));
+
+static void accel_context_init_state(struct accel_data *data) {
+    memset(data, 0, sizeof(*data));
+    // Same starting point as a device at init
+    data->last_time_ms = accel_clock_ms();
+}
+
+struct accel_context *accel_context_create(const struct device *dev) {
+    struct accel_context *ctx;
+
+    if (!dev || !dev->config) {
+        return NULL;
+    }
+    if (k_mem_slab_alloc(&accel_context_slab, (void **)&ctx, K_NO_WAIT) < 0) {
+        LOG_WRN("Device %s: All %d acceleration contexts in use", dev->name,
+                CONFIG_INPUT_PROCESSOR_ACCEL_CONTEXT_COUNT);
+        return NULL;
+    }
+    ctx->dev = dev;
+    accel_context_init_state(&ctx->data);
+    LOG_DBG("Device %s: Context %p created", dev->name, ctx);
+    return ctx;
+}
+
+void accel_context_destroy(struct accel_context *ctx) {
+    if (ctx) {
+        k_mem_slab_free(&accel_context_slab, ctx);
+    }
+}
+
+int accel_context_reset(struct accel_context *ctx) {
+    if (!ctx) {
+        return ACCEL_ERR_INVALID_ARG;
+    }
+    accel_context_init_state(&ctx->data);
+    return 0;
+}
+
+int accel_context_handle_event(struct accel_context *ctx, struct input_event *event) {
+    if (!ctx || !event) {
+        return ACCEL_ERR_INVALID_ARG;
+    }
+    const struct accel_config *cfg = ctx->dev->config;
+
+    // Same filter as accel_handle_event()
+    if (event->type != cfg->input_type) {
+        return ZMK_INPUT_PROC_CONTINUE;
+    }
+    if (event->code != INPUT_REL_X &&
+        event->code != INPUT_REL_Y &&
+        event->code != INPUT_REL_WHEEL &&
+        event->code != INPUT_REL_HWHEEL) {
+        return ZMK_INPUT_PROC_CONTINUE;
+    }
+
+    ACCEL_TRACE(cfg, "enter", event->code, event->value);
+    event->value = accel_pipeline_run(cfg, &ctx->data, event->code, event->value, event->sync);
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_TRANSFORM)
+    // A context has no device to report the other-axis term from; it is dropped
+    accel_transform_take_cross(&ctx->data);
+#endif
+    ACCEL_TRACE(cfg, "exit", event->code, event->value);
+    return ZMK_INPUT_PROC_CONTINUE;
+}
+
+uint32_t accel_context_count(void) {
+    return k_mem_slab_num_used_get(&accel_context_slab);
+}
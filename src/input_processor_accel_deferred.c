@@ -0,0 +1,329 @@
+// input_processor_accel_deferred.c - Deferred processing mode
+// The event handler only queues raw deltas; a low-priority worker thread
+// runs the stage chain and reports the output from the acceleration device
+//
+// Copyright (c) 2024 The ZMK Contributors
+// Modifications (c) 2025 NUOVOTAKA
+// SPDX-License-Identifier: MIT
+
+#include <zephyr/logging/log.h>
+#include <zephyr/kernel.h>
+#include <zephyr/input/input.h>
+#include "../include/drivers/input_processor_accel.h"
+
+LOG_MODULE_DECLARE(input_processor_accel);
+
+#define ACCEL_DEFERRED_DEPTH CONFIG_INPUT_PROCESSOR_ACCEL_DEFERRED_DEPTH
+
+// Free-running head/tail counters index the ring modulo its depth
+BUILD_ASSERT((ACCEL_DEFERRED_DEPTH & (ACCEL_DEFERRED_DEPTH - 1)) == 0,
+             "Deferred ring depth must be a power of two");
+
+// Queued entries tried as the newer half of a merge on a full ring
+#define ACCEL_DEFERRED_MERGE_TRIES 4
+
+#define ACCEL_DEFERRED_SLOT(q, n) (&(q)->ring[(n) & (ACCEL_DEFERRED_DEPTH - 1)])
+
+// Kconfig ranges cannot express NUM_PREEMPT_PRIORITIES - 1 (the idle level is excluded)
+BUILD_ASSERT(CONFIG_INPUT_PROCESSOR_ACCEL_DEFERRED_PRIORITY < CONFIG_NUM_PREEMPT_PRIORITIES,
+             "Deferred worker priority must be below CONFIG_NUM_PREEMPT_PRIORITIES");
+
+// =============================================================================
+// QUEUE STATE
+// =============================================================================
+
+struct accel_deferred_entry {
+    int32_t value;                 // Raw delta
+    uint32_t time_ms;              // Arrival time (accel_clock_ms())
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_ADAPTIVE_RATE)
+    uint32_t time_us;              // Arrival time (accel_clock_us())
+#endif
+    uint16_t code;                 // Event code
+    uint8_t sync;                  // Last event of the report
+};
+
+/**
+ * Event ring of one instance, drained by the worker.
+ * The handler may run in several contexts (input thread, driver ISR), and a
+ * full ring rewrites queued entries, so producers and the worker's claim of
+ * an entry hold the queue's spinlock. Processing runs outside it.
+ */
+struct accel_deferred_queue {
+    const struct device *dev;      // Owning instance (source of the processed events)
+    struct k_spinlock lock;        // Guards head, tail and the queued entries
+    atomic_t head;                 // Next slot to write (handler)
+    atomic_t tail;                 // Next slot to read (worker)
+    atomic_t enqueued;             // Events accepted into the ring
+    atomic_t processed;            // Events run through the pipeline
+    atomic_t coalesced;            // Events folded into queued entries on a full ring
+    atomic_t dropped;              // Events discarded (full ring, every entry at the input limit)
+    atomic_t high_water;           // Highest ring occupancy (handler writes)
+    struct accel_deferred_entry ring[ACCEL_DEFERRED_DEPTH];
+};
+
+static struct accel_deferred_queue accel_deferred_queues[ACCEL_MAX_INSTANCES];
+static atomic_t accel_deferred_queue_count;
+
+K_SEM_DEFINE(accel_deferred_sem, 0, 1);
+
+// =============================================================================
+// WORKER
+// =============================================================================
+
+// Report one processed event from the acceleration device (its own input
+// listener picks it up); a zero delta is only sent to close the report
+static void accel_deferred_report(struct accel_deferred_queue *q, uint16_t code, int32_t value,
+                                  bool sync) {
+    const struct accel_config *cfg = q->dev->config;
+
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_TRANSFORM)
+    // Other-axis term ahead of the event, so it lands in the same report
+    int32_t cross = accel_transform_take_cross(q->dev->data);
+    if (cross != 0) {
+        uint16_t cross_code = (code == INPUT_REL_X) ? INPUT_REL_Y : INPUT_REL_X;
+        input_report(q->dev, cfg->input_type, cross_code, cross, false, K_FOREVER);
+    }
+#endif
+
+    if (value != 0 || sync) {
+        input_report(q->dev, cfg->input_type, code, value, sync, K_FOREVER);
+    }
+}
+
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_XY_KERNEL)
+// Y entry that completes the report of a claimed X entry, at the same time
+static bool accel_deferred_pairs(const struct accel_deferred_entry *x,
+                                 const struct accel_deferred_entry *y) {
+    return x->code == INPUT_REL_X && !x->sync && x->value != 0 && y->code == INPUT_REL_Y &&
+           y->value != 0 && y->time_ms == x->time_ms
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_ADAPTIVE_RATE)
+           && y->time_us == x->time_us
+#endif
+        ;
+}
+#endif
+
+static void accel_deferred_drain(struct accel_deferred_queue *q) {
+    const struct accel_config *cfg = q->dev->config;
+    struct accel_data *data = q->dev->data;
+
+    while (true) {
+        // Claim the entry and release its slot before processing, so the
+        // handler can reuse it (or fold into the entries still queued)
+        k_spinlock_key_t key = k_spin_lock(&q->lock);
+        uint32_t tail = (uint32_t)atomic_get(&q->tail);
+        uint32_t head = (uint32_t)atomic_get(&q->head);
+        if (tail == head) {
+            k_spin_unlock(&q->lock, key);
+            break;
+        }
+        struct accel_deferred_entry entry = *ACCEL_DEFERRED_SLOT(q, tail);
+        uint32_t claimed = 1;
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_XY_KERNEL)
+        // The report's Y entry is claimed with its X, for the packed level stage
+        struct accel_deferred_entry pair = {0};
+        if (tail + 1 != head) {
+            pair = *ACCEL_DEFERRED_SLOT(q, tail + 1);
+            claimed = accel_deferred_pairs(&entry, &pair) ? 2 : 1;
+        }
+#endif
+        atomic_set(&q->tail, (atomic_val_t)(tail + claimed));
+        k_spin_unlock(&q->lock, key);
+
+        // Speed, burst timing and carry see the arrival time, not the worker's
+        data->event_time_ms = entry.time_ms;
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_ADAPTIVE_RATE)
+        data->event_time_us = entry.time_us;
+#endif
+        data->event_time_valid = 1;
+
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_XY_KERNEL)
+        if (claimed == 2) {
+            int32_t x = entry.value;
+            int32_t y = pair.value;
+            if (accel_pipeline_run_xy(cfg, data, &x, &y, pair.sync)) {
+                data->event_time_valid = 0;
+                atomic_add(&q->processed, 2);
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_TRANSFORM)
+                // Both axes are at hand: Y's Y->X term joins the X event
+                x += accel_transform_take_cross(data);
+                x = ACCEL_CLAMP(x, INT16_MIN, INT16_MAX);
+#endif
+                accel_deferred_report(q, INPUT_REL_X, x, false);
+                accel_deferred_report(q, INPUT_REL_Y, y, pair.sync);
+                continue;
+            }
+        }
+#endif
+
+        int32_t value = accel_pipeline_run(cfg, data, entry.code, entry.value, entry.sync);
+        data->event_time_valid = 0;
+        atomic_inc(&q->processed);
+        accel_deferred_report(q, entry.code, value, entry.sync);
+
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_XY_KERNEL)
+        // Claimed as a pair but not packable in this configuration
+        if (claimed == 2) {
+            data->event_time_valid = 1;
+            value = accel_pipeline_run(cfg, data, pair.code, pair.value, pair.sync);
+            data->event_time_valid = 0;
+            atomic_inc(&q->processed);
+            accel_deferred_report(q, pair.code, value, pair.sync);
+        }
+#endif
+    }
+}
+
+static void accel_deferred_thread(void *p1, void *p2, void *p3) {
+    ARG_UNUSED(p1);
+    ARG_UNUSED(p2);
+    ARG_UNUSED(p3);
+
+    while (true) {
+        k_sem_take(&accel_deferred_sem, K_FOREVER);
+
+        int count = (int)atomic_get(&accel_deferred_queue_count);
+        for (int i = 0; i < count; i++) {
+            // Slot is claimed before its device is set (see accel_deferred_attach)
+            if (accel_deferred_queues[i].dev) {
+                accel_deferred_drain(&accel_deferred_queues[i]);
+            }
+        }
+    }
+}
+
+K_THREAD_DEFINE(accel_deferred_tid, CONFIG_INPUT_PROCESSOR_ACCEL_DEFERRED_STACK_SIZE,
+                accel_deferred_thread, NULL, NULL, NULL,
+                K_PRIO_PREEMPT(CONFIG_INPUT_PROCESSOR_ACCEL_DEFERRED_PRIORITY), 0, 0);
+
+// =============================================================================
+// HANDLER SIDE
+// =============================================================================
+
+int accel_deferred_attach(const struct device *dev) {
+    if (!dev || !dev->data) {
+        return ACCEL_ERR_INVALID_ARG;
+    }
+
+    int index = (int)atomic_inc(&accel_deferred_queue_count);
+    if (index >= ACCEL_MAX_INSTANCES) {
+        atomic_dec(&accel_deferred_queue_count);
+        return ACCEL_ERR_NO_MEMORY;
+    }
+
+    struct accel_deferred_queue *q = &accel_deferred_queues[index];
+    struct accel_data *data = dev->data;
+    data->deferred = q;
+    q->dev = dev;
+
+    LOG_INF("Deferred processing: %d-entry ring, worker priority %d",
+            ACCEL_DEFERRED_DEPTH, CONFIG_INPUT_PROCESSOR_ACCEL_DEFERRED_PRIORITY);
+    return 0;
+}
+
+static struct accel_deferred_entry accel_deferred_entry_make(uint16_t code, int32_t value,
+                                                             bool sync) {
+    return (struct accel_deferred_entry){
+        .value = value,
+        .time_ms = accel_clock_ms(),
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_ADAPTIVE_RATE)
+        .time_us = accel_clock_us(),
+#endif
+        .code = code,
+        .sync = sync,
+    };
+}
+
+// A sum the pipeline takes without clamping, so folding keeps all the motion
+static bool accel_deferred_fits(int32_t a, int32_t b) {
+    int64_t sum = (int64_t)a + b;
+    return sum >= -MAX_REASONABLE_INPUT && sum <= MAX_REASONABLE_INPUT;
+}
+
+/**
+ * @brief Keep an event's motion when the ring is full (caller holds the lock)
+ * The delta joins the newest queued entry of the same code. Without one (e.g.
+ * a wheel event while X/Y fill the ring), a recent entry is merged into an
+ * older one of its code and the event takes the freed last slot. Merged
+ * entries keep the older arrival time, so timestamps stay in order.
+ * @return false only if no entry has room below the input limit
+ */
+static bool accel_deferred_fold(struct accel_deferred_queue *q, uint32_t tail, uint32_t head,
+                                uint16_t code, int32_t value, bool sync) {
+    for (uint32_t n = head; n-- != tail;) {
+        struct accel_deferred_entry *entry = ACCEL_DEFERRED_SLOT(q, n);
+        if (entry->code == code && accel_deferred_fits(entry->value, value)) {
+            entry->value += value;
+            // The newest entry closes the report instead
+            ACCEL_DEFERRED_SLOT(q, head - 1)->sync |= sync;
+            return true;
+        }
+    }
+
+    uint32_t tries = 0;
+    for (uint32_t k = head; --k != tail && tries < ACCEL_DEFERRED_MERGE_TRIES; tries++) {
+        struct accel_deferred_entry *newer = ACCEL_DEFERRED_SLOT(q, k);
+        for (uint32_t n = k; n-- != tail;) {
+            struct accel_deferred_entry *older = ACCEL_DEFERRED_SLOT(q, n);
+            if (older->code != newer->code || !accel_deferred_fits(older->value, newer->value)) {
+                continue;
+            }
+            older->value += newer->value;
+            ACCEL_DEFERRED_SLOT(q, k - 1)->sync |= newer->sync;
+            for (uint32_t m = k; m + 1 != head; m++) {
+                *ACCEL_DEFERRED_SLOT(q, m) = *ACCEL_DEFERRED_SLOT(q, m + 1);
+            }
+            *ACCEL_DEFERRED_SLOT(q, head - 1) = accel_deferred_entry_make(code, value, sync);
+            return true;
+        }
+    }
+    return false;
+}
+
+int accel_deferred_enqueue(struct accel_data *data, uint16_t code, int32_t value, bool sync) {
+    struct accel_deferred_queue *q = data->deferred;
+    if (!q) {
+        return ACCEL_ERR_INVALID_ARG; // Not attached (init failed)
+    }
+
+    k_spinlock_key_t key = k_spin_lock(&q->lock);
+    uint32_t head = (uint32_t)atomic_get(&q->head);
+    uint32_t tail = (uint32_t)atomic_get(&q->tail);
+    uint32_t used = head - tail;
+
+    if (used < ACCEL_DEFERRED_DEPTH) {
+        *ACCEL_DEFERRED_SLOT(q, head) = accel_deferred_entry_make(code, value, sync);
+        atomic_set(&q->head, (atomic_val_t)(head + 1));
+        atomic_inc(&q->enqueued);
+        if (used + 1 > (uint32_t)atomic_get(&q->high_water)) {
+            atomic_set(&q->high_water, (atomic_val_t)(used + 1));
+        }
+    } else if (accel_deferred_fold(q, tail, head, code, value, sync)) {
+        atomic_inc(&q->coalesced);
+    } else {
+        atomic_inc(&q->dropped);
+    }
+    k_spin_unlock(&q->lock, key);
+
+    k_sem_give(&accel_deferred_sem);
+    return 0;
+}
+
+int accel_deferred_get_stats(const struct device *dev, struct accel_deferred_stats *stats) {
+    if (!dev || !dev->data || !stats) {
+        return ACCEL_ERR_INVALID_ARG;
+    }
+    const struct accel_data *data = dev->data;
+    const struct accel_deferred_queue *q = data->deferred;
+    if (!q) {
+        return ACCEL_ERR_INVALID_ARG;
+    }
+
+    stats->enqueued = (uint32_t)atomic_get(&q->enqueued);
+    stats->processed = (uint32_t)atomic_get(&q->processed);
+    stats->coalesced = (uint32_t)atomic_get(&q->coalesced);
+    stats->dropped = (uint32_t)atomic_get(&q->dropped);
+    stats->high_water = (uint16_t)atomic_get(&q->high_water);
+    stats->depth = ACCEL_DEFERRED_DEPTH;
+    return 0;
+}
@@ -0,0 +1,111 @@
+// input_processor_accel_log.c - Rate-limited reporting of hot-path events
+// The event path only sets atomic flags and counters; a periodic work item
+// turns them into log lines
+//
+// Copyright (c) 2024 The ZMK Contributors
+// Modifications (c) 2025 NUOVOTAKA
+// SPDX-License-Identifier: MIT
+
+#include <zephyr/logging/log.h>
+#include <zephyr/kernel.h>
+#include "../include/drivers/input_processor_accel.h"
+
+LOG_MODULE_DECLARE(input_processor_accel);
+
+#define ACCEL_LOG_SUMMARY_MS CONFIG_INPUT_PROCESSOR_ACCEL_LOG_SUMMARY_MS
+
+// =============================================================================
+// STATE
+// =============================================================================
+
+static struct accel_log_state accel_log_states[ACCEL_MAX_INSTANCES];
+static atomic_t accel_log_state_count;
+
+static const char *const accel_log_event_names[ACCEL_LOG_EVENT_COUNT] = {
+    [ACCEL_LOG_INPUT_REJECTED] = "extreme input rejected",
+    [ACCEL_LOG_INVALID_CONFIG] = "invalid setting, safe value used",
+    [ACCEL_LOG_OVERFLOW]       = "overflow guard, conservative calculation",
+    [ACCEL_LOG_CLAMPED]        = "result clamped to int16 range",
+    [ACCEL_LOG_SUSPICIOUS]     = "suspicious result replaced",
+    [ACCEL_LOG_SPEED_RESET]    = "invalid speed state reset",
+    [ACCEL_LOG_SPEED_FALLBACK] = "speed out of range, fallback used",
+};
+
+// =============================================================================
+// PERIODIC SUMMARY
+// =============================================================================
+
+static void accel_log_summary(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(accel_log_work, accel_log_summary);
+
+static void accel_log_summary(struct k_work *work) {
+    ARG_UNUSED(work);
+
+    int count = (int)atomic_get(&accel_log_state_count);
+    for (int i = 0; i < count; i++) {
+        struct accel_log_state *log = &accel_log_states[i];
+        if (!log->dev) {
+            continue;
+        }
+
+        atomic_val_t flags = atomic_clear(&log->flags);
+        for (int event = 0; flags != 0 && event < ACCEL_LOG_EVENT_COUNT; event++) {
+            if (!(flags & BIT(event))) {
+                continue;
+            }
+            uint32_t total = (uint32_t)atomic_get(&log->counts[event]);
+            LOG_WRN("%s: %s x%u (total %u)", log->dev->name, accel_log_event_names[event],
+                    total - log->reported[event], total);
+            log->reported[event] = total;
+        }
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_DEBUG_LOG)
+        LOG_DBG("%s: last input=%d speed=%d factor=%d output=%d", log->dev->name,
+                (int)log->debug[0], (int)log->debug[1], (int)log->debug[2], (int)log->debug[3]);
+#endif
+    }
+
+    k_work_schedule(&accel_log_work, K_MSEC(ACCEL_LOG_SUMMARY_MS));
+}
+
+// =============================================================================
+// PUBLIC API
+// =============================================================================
+
+int accel_log_attach(const struct device *dev) {
+    if (!dev || !dev->config) {
+        return ACCEL_ERR_INVALID_ARG;
+    }
+
+    int index = (int)atomic_inc(&accel_log_state_count);
+    if (index >= ACCEL_MAX_INSTANCES) {
+        atomic_dec(&accel_log_state_count);
+        return ACCEL_ERR_NO_MEMORY;
+    }
+
+    struct accel_log_state *log = &accel_log_states[index];
+    struct accel_config *cfg = (struct accel_config *)dev->config;
+    log->dev = dev;
+    cfg->log = log;
+
+    // 0 keeps the counters but never formats a summary
+    if (ACCEL_LOG_SUMMARY_MS > 0) {
+        k_work_schedule(&accel_log_work, K_MSEC(ACCEL_LOG_SUMMARY_MS));
+    }
+    return 0;
+}
+
+int accel_get_event_counts(const struct device *dev, uint32_t counts[ACCEL_LOG_EVENT_COUNT]) {
+    if (!dev || !dev->config || !counts) {
+        return ACCEL_ERR_INVALID_ARG;
+    }
+    const struct accel_config *cfg = dev->config;
+    const struct accel_log_state *log = cfg->log;
+    if (!log) {
+        return ACCEL_ERR_INVALID_ARG;
+    }
+
+    for (int event = 0; event < ACCEL_LOG_EVENT_COUNT; event++) {
+        counts[event] = (uint32_t)atomic_get(&log->counts[event]);
+    }
+    return 0;
+}
@@ -11,7 +11,9 @@
 #include <drivers/input_processor.h>
 #include "../include/drivers/input_processor_accel.h"
 #include "config/accel_config.h"
+#include "config/accel_config_adapter.h"
 #include "config/accel_device_init.h"
+#include "presets/accel_presets.h"
 
 LOG_MODULE_REGISTER(input_processor_accel, CONFIG_ZMK_LOG_LEVEL);
 
@@ -20,16 +22,62 @@ LOG_MODULE_REGISTER(input_processor_accel, CONFIG_ZMK_LOG_LEVEL);
 #if DT_HAS_COMPAT_STATUS_OKAY(DT_DRV_COMPAT)
 
 // =============================================================================
-// MEMORY POOL DEFINITION
+// DEVICE INITIALIZATION
 // =============================================================================
 
-// Define the memory pool for acceleration data (only once in main.c)
-K_MEM_SLAB_DEFINE(accel_data_pool, sizeof(struct accel_data), ACCEL_MAX_INSTANCES, ACCEL_DATA_POOL_ALIGNMENT);
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_INIT_TIMING)
+// Device init runs sequentially on one thread, so one set of stamps is enough
+static uint32_t accel_init_cycles[ACCEL_INIT_PHASE_COUNT];
+static uint32_t accel_init_stamp;
 
-// =============================================================================
-// DEVICE INITIALIZATION
-// =============================================================================
+static void accel_init_timing_start(void) {
+    memset(accel_init_cycles, 0, sizeof(accel_init_cycles));
+    accel_init_stamp = k_cycle_get_32();
+}
+
+static void accel_init_timing_phase(enum accel_init_phase phase) {
+    uint32_t now = k_cycle_get_32();
+    accel_init_cycles[phase] += now - accel_init_stamp;
+    accel_init_stamp = now;
+}
+
+static void accel_init_timing_report(const struct device *dev) {
+    struct accel_data *data = dev->data;
+    uint32_t total = 0;
+
+    for (int phase = 0; phase < ACCEL_INIT_PHASE_COUNT; phase++) {
+        data->init_cycles[phase] = accel_init_cycles[phase];
+        total += accel_init_cycles[phase];
+    }
+    LOG_INF("Device %s: init cycles config=%u dt=%u validate=%u state=%u pipeline=%u "
+            "total=%u (%u us)", dev->name,
+            accel_init_cycles[ACCEL_INIT_PHASE_CONFIG],
+            accel_init_cycles[ACCEL_INIT_PHASE_DEVICETREE],
+            accel_init_cycles[ACCEL_INIT_PHASE_VALIDATE],
+            accel_init_cycles[ACCEL_INIT_PHASE_STATE],
+            accel_init_cycles[ACCEL_INIT_PHASE_PIPELINE],
+            total, k_cyc_to_us_floor32(total));
+}
+
+int accel_get_init_cycles(const struct device *dev, uint32_t cycles[ACCEL_INIT_PHASE_COUNT]) {
+    if (!dev || !dev->data || !cycles) {
+        return ACCEL_ERR_INVALID_ARG;
+    }
+    const struct accel_data *data = dev->data;
+    memcpy(cycles, data->init_cycles, sizeof(data->init_cycles));
+    return 0;
+}
 
+#define ACCEL_INIT_TIMING_START()      accel_init_timing_start()
+#define ACCEL_INIT_TIMING_PHASE(phase) accel_init_timing_phase(phase)
+#define ACCEL_INIT_TIMING_REPORT(dev)  accel_init_timing_report(dev)
+#else
+#define ACCEL_INIT_TIMING_START()
+#define ACCEL_INIT_TIMING_PHASE(phase)
+#define ACCEL_INIT_TIMING_REPORT(dev)
+#endif
+
+#if !defined(CONFIG_INPUT_PROCESSOR_ACCEL_CONST_CONFIG)
 static int accel_init_device(const struct device *dev) {
     const struct accel_config *cfg = dev->config;
     struct accel_data *data = dev->data;
@@ -40,6 +88,7 @@ static int accel_init_device(const struct device *dev) {
         LOG_ERR("Device %s: Configuration validation failed: %d", dev->name, ret);
         return ret; // Pass through validation error code
     }
+    ACCEL_INIT_TIMING_PHASE(ACCEL_INIT_PHASE_VALIDATE);
     
     // Enhanced NULL pointer validation and initialization
     if (!data) {
@@ -47,28 +96,228 @@ static int accel_init_device(const struct device *dev) {
         return ACCEL_ERR_NO_MEMORY;
     }
     
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_LAZY_STATE)
+    // Static runtime data is already zero; speed tracking and the budget
+    // table start with the first event
+#else
     // Initialize runtime data structures - ensure proper memory initialization
     memset(data, 0, sizeof(struct accel_data));
     // Initialize timing data to prevent division by zero
-    data->last_time_ms = k_uptime_get_32();
+    data->last_time_ms = accel_clock_ms();
     data->recent_speed = 0;
     
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_BUDGET)
+    // Fast-path table used when the cycle budget is repeatedly exceeded
+    accel_budget_build_lut(cfg, data);
+#endif
+#endif
+    ACCEL_INIT_TIMING_PHASE(ACCEL_INIT_PHASE_STATE);
+    
+    // Hot-path conditions are counted per instance and summarized later
+    ret = accel_log_attach(dev);
+    if (ret < 0) {
+        LOG_WRN("Device %s: Event counters unavailable: %d", dev->name, ret);
+    }
+    
+    // Resolve the processing chain once for this instance
+    ret = accel_pipeline_build((struct accel_config *)cfg);
+    if (ret < 0) {
+        LOG_ERR("Device %s: Pipeline setup failed: %d", dev->name, ret);
+        return ret;
+    }
+    
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_DEFERRED)
+    // Hand the instance to the deferred worker
+    ret = accel_deferred_attach(dev);
+    if (ret < 0) {
+        LOG_ERR("Device %s: Deferred queue setup failed: %d", dev->name, ret);
+        return ret;
+    }
+#endif
+    ACCEL_INIT_TIMING_PHASE(ACCEL_INIT_PHASE_PIPELINE);
+    ACCEL_INIT_TIMING_REPORT(dev);
+    
     LOG_INF("Device %s: Acceleration processor ready (Level %d)", dev->name, cfg->level);
     return 0;
 }
+#endif // !CONFIG_INPUT_PROCESSOR_ACCEL_CONST_CONFIG
 
 // =============================================================================
 // DEVICE INSTANCE CREATION USING DT_INST_FOREACH_STATUS_OKAY
 // =============================================================================
 
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_CONST_CONFIG)
+// Each instance's final configuration is a const initializer (flash):
+// custom devicetree values, the Kconfig preset or the level defaults,
+// range-checked at build time instead of clamped and validated at boot
+
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_PRESET_CUSTOM)
+#define ACCEL_CONST_PARAM(inst, prop, preset_field, fallback) DT_INST_PROP_OR(inst, prop, fallback)
+#elif defined(ACCEL_KCONFIG_PRESET)
+#define ACCEL_CONST_PARAM(inst, prop, preset_field, fallback) preset_field(ACCEL_KCONFIG_PRESET)
+#else
+#define ACCEL_CONST_PARAM(inst, prop, preset_field, fallback) (fallback)
+#endif
+
+// Presets keep the default exponent (accel_config_apply_preset())
+#define ACCEL_CONST_PRESET_EXPONENT(...) ACCEL_DEFAULT_EXPONENT
+
+#define ACCEL_CONST_SENSITIVITY(inst)                                                            \
+    ACCEL_CONST_PARAM(inst, sensitivity, ACCEL_PRESET_SENSITIVITY, ACCEL_DEFAULT_SENSITIVITY)
+#define ACCEL_CONST_MAX_FACTOR(inst)                                                             \
+    ACCEL_CONST_PARAM(inst, max_factor, ACCEL_PRESET_MAX_FACTOR, ACCEL_DEFAULT_MAX_FACTOR)
+#define ACCEL_CONST_CURVE_TYPE(inst)                                                             \
+    ACCEL_CONST_PARAM(inst, curve_type, ACCEL_PRESET_CURVE_TYPE, ACCEL_DEFAULT_CURVE_TYPE)
+#define ACCEL_CONST_Y_BOOST(inst)                                                                \
+    ACCEL_CONST_PARAM(inst, y_boost, ACCEL_PRESET_Y_BOOST, SENSITIVITY_SCALE)
+#define ACCEL_CONST_SENSOR_DPI(inst)                                                             \
+    ACCEL_CONST_PARAM(inst, sensor_dpi, ACCEL_PRESET_SENSOR_DPI, STANDARD_DPI_REFERENCE)
+#define ACCEL_CONST_SPEED_THRESHOLD(inst)                                                        \
+    ACCEL_CONST_PARAM(inst, speed_threshold, ACCEL_PRESET_SPEED_THRESHOLD, ACCEL_DEFAULT_SPEED_THRESHOLD)
+#define ACCEL_CONST_SPEED_MAX(inst)                                                              \
+    ACCEL_CONST_PARAM(inst, speed_max, ACCEL_PRESET_SPEED_MAX, ACCEL_DEFAULT_SPEED_MAX)
+#define ACCEL_CONST_MIN_FACTOR(inst)                                                             \
+    ACCEL_CONST_PARAM(inst, min_factor, ACCEL_PRESET_MIN_FACTOR, ACCEL_DEFAULT_MIN_FACTOR)
+#define ACCEL_CONST_EXPONENT(inst)                                                               \
+    ACCEL_CONST_PARAM(inst, acceleration_exponent, ACCEL_CONST_PRESET_EXPONENT, ACCEL_DEFAULT_EXPONENT)
+
+#define ACCEL_CONST_IN_RANGE(val, min, max) ((val) >= (min) && (val) <= (max))
+
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_LEVEL_STANDARD)
+#define ACCEL_CONST_LEVEL  2
+#define ACCEL_CONST_STAGES accel_pipeline_level2
+#define ACCEL_CONST_LEVEL_CONFIG(inst)                                                           \
+    .cfg.level2 = {                                                                             \
+        .sensitivity = ACCEL_CONST_SENSITIVITY(inst),                                           \
+        .max_factor = ACCEL_CONST_MAX_FACTOR(inst),                                             \
+        .min_factor = ACCEL_CONST_MIN_FACTOR(inst),                                             \
+        .speed_threshold = ACCEL_CONST_SPEED_THRESHOLD(inst),                                   \
+        .speed_max = ACCEL_CONST_SPEED_MAX(inst),                                               \
+        .acceleration_exponent = ACCEL_CONST_EXPONENT(inst),                                    \
+    }
+#define ACCEL_CONST_LEVEL_CHECK(inst)                                                            \
+    BUILD_ASSERT(ACCEL_CONST_IN_RANGE(ACCEL_CONST_SPEED_THRESHOLD(inst),                         \
+                                      SPEED_THRESHOLD_MIN, SPEED_THRESHOLD_MAX),                 \
+                 "speed-threshold outside 100-2000");                                           \
+    BUILD_ASSERT(ACCEL_CONST_IN_RANGE(ACCEL_CONST_SPEED_MAX(inst), SPEED_MAX_MIN, SPEED_MAX_MAX), \
+                 "speed-max outside 1000-8000");                                                \
+    BUILD_ASSERT(ACCEL_CONST_SPEED_MAX(inst) > ACCEL_CONST_SPEED_THRESHOLD(inst),               \
+                 "speed-max must be greater than speed-threshold");                             \
+    BUILD_ASSERT(ACCEL_CONST_IN_RANGE(ACCEL_CONST_MIN_FACTOR(inst), MIN_FACTOR_MIN, MIN_FACTOR_MAX), \
+                 "min-factor outside 200-1500");                                                \
+    BUILD_ASSERT(ACCEL_CONST_MIN_FACTOR(inst) <= ACCEL_CONST_MAX_FACTOR(inst),                  \
+                 "min-factor must not exceed max-factor");                                      \
+    BUILD_ASSERT(ACCEL_CONST_IN_RANGE(ACCEL_CONST_EXPONENT(inst),                               \
+                                      ACCEL_EXPONENT_MIN, ACCEL_EXPONENT_MAX),                   \
+                 "acceleration-exponent outside 1-5");
+#else
+#define ACCEL_CONST_LEVEL  1
+#define ACCEL_CONST_STAGES accel_pipeline_level1
+#define ACCEL_CONST_LEVEL_CONFIG(inst)                                                           \
+    .cfg.level1 = {                                                                             \
+        .sensitivity = ACCEL_CONST_SENSITIVITY(inst),                                           \
+        .max_factor = ACCEL_CONST_MAX_FACTOR(inst),                                             \
+        .curve_type = ACCEL_CONST_CURVE_TYPE(inst),                                             \
+    }
+#define ACCEL_CONST_LEVEL_CHECK(inst)                                                            \
+    BUILD_ASSERT(ACCEL_CONST_IN_RANGE(ACCEL_CONST_CURVE_TYPE(inst), CURVE_TYPE_MIN, CURVE_TYPE_MAX), \
+                 "curve-type outside 0-2");
+#endif
+
+// The ranges the runtime path clamps to, and what accel_validate_config() checks
+#define ACCEL_CONST_CHECK(inst)                                                                  \
+    BUILD_ASSERT(ACCEL_CONST_IN_RANGE(ACCEL_CONST_SENSITIVITY(inst),                             \
+                                      SENSITIVITY_MIN, SENSITIVITY_MAX),                         \
+                 "sensitivity outside 200-2000");                                               \
+    BUILD_ASSERT(ACCEL_CONST_IN_RANGE(ACCEL_CONST_MAX_FACTOR(inst), MAX_FACTOR_MIN, MAX_FACTOR_MAX), \
+                 "max-factor outside 1000-5000");                                               \
+    BUILD_ASSERT(ACCEL_CONST_IN_RANGE(ACCEL_CONST_Y_BOOST(inst), 1000, 3000),                   \
+                 "y-boost outside 1000-3000");                                                  \
+    BUILD_ASSERT(ACCEL_CONST_IN_RANGE(ACCEL_CONST_SENSOR_DPI(inst), SENSOR_DPI_MIN, SENSOR_DPI_MAX), \
+                 "sensor-dpi outside the supported range");                                     \
+    ACCEL_CONST_LEVEL_CHECK(inst)
+
+static const uint16_t accel_const_codes[] = { INPUT_REL_X, INPUT_REL_Y, INPUT_REL_WHEEL, INPUT_REL_HWHEEL };
+
+#define ACCEL_CONST_CONFIG_INIT(inst)                                                            \
+    {                                                                                           \
+        .stages = ACCEL_CONST_STAGES,                                                           \
+        .log = NULL, /* Event counters need a writable config */                                \
+        .dpi_sensitivity = ACCEL_DPI_SENSITIVITY(ACCEL_CONST_SENSITIVITY(inst),                 \
+            ACCEL_DPI_SCALE_Q16(ACCEL_ADJUST_DPI(ACCEL_CONST_SENSOR_DPI(inst)))),                \
+        IF_ENABLED(CONFIG_INPUT_PROCESSOR_ACCEL_WIDE_RANGE,                                     \
+                   (.prescale_q16 = ACCEL_PRESCALE_Q16(ACCEL_CONST_SENSOR_DPI(inst)),))          \
+        ACCEL_CONST_LEVEL_CONFIG(inst),                                                         \
+        .y_boost_scaled = (ACCEL_CONST_Y_BOOST(inst) - SENSITIVITY_SCALE) / 10,                 \
+        .input_type = INPUT_EV_REL,                                                             \
+        .level = ACCEL_CONST_LEVEL,                                                             \
+        .stage_count = ACCEL_PIPELINE_CONST_STAGES,                                             \
+        IF_ENABLED(CONFIG_INPUT_PROCESSOR_ACCEL_TRACING, (.instance = inst,))                   \
+        .codes = accel_const_codes,                                                             \
+        .codes_count = ARRAY_SIZE(accel_const_codes),                                           \
+        .sensor_dpi = ACCEL_CONST_SENSOR_DPI(inst),                                             \
+    }
+
+// Nothing to set up unless a feature keeps per-instance runtime tables;
+// zeroed runtime data starts speed tracking at the first event
+static int accel_init_const(const struct device *dev) {
+    int ret = 0;
+
+    ARG_UNUSED(dev);
+    ACCEL_INIT_TIMING_START();
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_BUDGET) && !defined(CONFIG_INPUT_PROCESSOR_ACCEL_LAZY_STATE)
+    accel_budget_build_lut(dev->config, dev->data);
+#endif
+    ACCEL_INIT_TIMING_PHASE(ACCEL_INIT_PHASE_STATE);
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_DEFERRED)
+    ret = accel_deferred_attach(dev);
+#endif
+    ACCEL_INIT_TIMING_PHASE(ACCEL_INIT_PHASE_PIPELINE);
+    ACCEL_INIT_TIMING_REPORT(dev);
+    return ret;
+}
+
+#define ACCEL_DEVICE_DEFINE(inst)                                                               \
+    ACCEL_CONST_CHECK(inst)                                                                    \
+    static struct accel_data accel_data_##inst;                                                \
+    static const struct accel_config accel_config_##inst = ACCEL_CONST_CONFIG_INIT(inst);      \
+    DEVICE_DT_INST_DEFINE(inst,                                                                \
+                          accel_init_const,                                                     \
+                          NULL,                                                                 \
+                          &accel_data_##inst,                                                   \
+                          &accel_config_##inst,                                                 \
+                          POST_KERNEL,                                                          \
+                          CONFIG_INPUT_PROCESSOR_ACCELERATION_INIT_PRIORITY,                    \
+                          &(const struct zmk_input_processor_driver_api){                      \
+                              .handle_event = accel_handle_event                                \
+                          });
+#else
+// Apply the transform-matrix DT property when present
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_TRANSFORM)
+#define ACCEL_TRANSFORM_APPLY_DT(inst, cfg)                                                      \
+    COND_CODE_1(DT_INST_NODE_HAS_PROP(inst, transform_matrix),                                  \
+        (BUILD_ASSERT(DT_INST_PROP_LEN(inst, transform_matrix) == ACCEL_TRANSFORM_SIZE,         \
+                      "transform-matrix needs 4 entries (m00 m01 m10 m11)");                    \
+         accel_transform_set(cfg,                                                               \
+                             (int32_t)DT_INST_PROP_BY_IDX(inst, transform_matrix, 0),           \
+                             (int32_t)DT_INST_PROP_BY_IDX(inst, transform_matrix, 1),           \
+                             (int32_t)DT_INST_PROP_BY_IDX(inst, transform_matrix, 2),           \
+                             (int32_t)DT_INST_PROP_BY_IDX(inst, transform_matrix, 3))),         \
+        ())
+#else
+#define ACCEL_TRANSFORM_APPLY_DT(inst, cfg)
+#endif
+
 // Macro to create device instance initialization function
 #define ACCEL_INIT_FUNC(inst)                                                                     \
     static int accel_init_##inst(const struct device *dev) {                                     \
+        ACCEL_INIT_TIMING_START();                                                               \
         /* Initialize device instance configuration */                                           \
         int ret = accel_device_init_instance(dev, inst);                                        \
         if (ret < 0) {                                                                           \
             return ret;                                                                          \
         }                                                                                        \
+        ACCEL_INIT_TIMING_PHASE(ACCEL_INIT_PHASE_CONFIG);                                        \
                                                                                                   \
         /* Apply DT custom properties if enabled (must be done in macro context) */            \
         struct accel_config *cfg = (struct accel_config *)dev->config;                          \
@@ -85,7 +334,7 @@ static int accel_init_device(const struct device *dev) {
             } \
             cfg->y_boost_scaled = ACCEL_CLAMP((DT_INST_PROP_OR(inst, y_boost, SENSITIVITY_SCALE) - SENSITIVITY_SCALE) / 10, 0, 200); \
             uint16_t dpi = ACCEL_CLAMP(DT_INST_PROP_OR(inst, sensor_dpi, STANDARD_DPI_REFERENCE), SENSOR_DPI_MIN, SENSOR_DPI_MAX); \
-            cfg->sensor_dpi_class = (dpi <= 400) ? 0 : (dpi <= 800) ? 1 : (dpi <= 1200) ? 2 : (dpi <= 1600) ? 3 : (dpi <= 3200) ? 4 : (dpi <= 6400) ? 5 : 6; \
+            accel_set_sensor_dpi(cfg, dpi); \
                                                                                                   \
             /* Apply Level 2 specific DTS properties only for Standard level */                \
             if (cfg->level == 2) {                                                              \
@@ -96,6 +345,13 @@ static int accel_init_device(const struct device *dev) {
             }                                                                                    \
         }                                                                                        \
                                                                                                   \
+        /* Optional output transform matrix (independent of presets) */                        \
+        ACCEL_TRANSFORM_APPLY_DT(inst, cfg);                                                    \
+                                                                                                  \
+        /* Trace id of this instance */                                                        \
+        IF_ENABLED(CONFIG_INPUT_PROCESSOR_ACCEL_TRACING, (cfg->instance = inst;))               \
+        ACCEL_INIT_TIMING_PHASE(ACCEL_INIT_PHASE_DEVICETREE);                                    \
+                                                                                                  \
         /* Final device initialization and validation */                                        \
         return accel_init_device(dev);                                                          \
     }
@@ -116,6 +372,8 @@ static int accel_init_device(const struct device *dev) {
                               .handle_event = accel_handle_event                                \
                           });
 
+#endif // CONFIG_INPUT_PROCESSOR_ACCEL_CONST_CONFIG
+
 // Create device instances for all enabled DT nodes
 DT_INST_FOREACH_STATUS_OKAY(ACCEL_DEVICE_DEFINE)
 
@@ -134,21 +392,27 @@ DT_INST_FOREACH_STATUS_OKAY(ACCEL_DEVICE_DEFINE)
 int accel_handle_event(const struct device *dev, struct input_event *event,
                       uint32_t param1, uint32_t param2,
                       struct zmk_input_processor_state *state) {
+    ARG_UNUSED(param1);
+    ARG_UNUSED(param2);
+    ARG_UNUSED(state);
+
     // CRITICAL: Minimize interrupt processing time
-    // Enhanced NULL pointer validation with proper error reporting
-    if (!dev) {
+    // Enhanced NULL pointer validation with proper error reporting. Device,
+    // config and data are static (DEVICE_DT_INST_DEFINE), so the fast path
+    // only asserts them
+    if (ACCEL_GUARD(!dev)) {
         LOG_ERR("Device pointer is NULL in event handler");
         return ACCEL_ERR_INVALID_ARG;
     }
-    if (!event) {
+    if (ACCEL_GUARD(!event)) {
         LOG_ERR("Event pointer is NULL in event handler");
         return ACCEL_ERR_INVALID_ARG;
     }
-    if (!dev->config) {
+    if (ACCEL_GUARD(!dev->config)) {
         LOG_ERR("Device config is NULL for device %s", dev->name ? dev->name : "unknown");
         return ACCEL_ERR_NO_DEVICE;
     }
-    if (!dev->data) {
+    if (ACCEL_GUARD(!dev->data)) {
         LOG_ERR("Device data is NULL for device %s", dev->name ? dev->name : "unknown");
         return ACCEL_ERR_NO_DEVICE;
     }
@@ -170,48 +434,40 @@ int accel_handle_event(const struct device *dev, struct input_event *event,
         return ZMK_INPUT_PROC_CONTINUE; // Unsupported axis, continue processing
     }
     
-    // Check for zero movement (no acceleration needed)
-    if (event->value == 0) {
-        return ZMK_INPUT_PROC_CONTINUE; // No movement to accelerate, continue processing
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_DEFERRED) || defined(CONFIG_INPUT_PROCESSOR_ACCEL_TRANSFORM)
+    // Output reported from this device (worker, transform cross term) is final
+    if (event->dev == dev) {
+        return ZMK_INPUT_PROC_CONTINUE;
     }
-    
-    // Skip expensive validation in interrupt context
-    // (validation done at initialization time)
-    
-    // Fast input clamping
-    int32_t input_value = accel_clamp_input_value(event->value);
+#endif
 
-    // OPTIMIZED: Fast-path processing with minimal overhead
-    int32_t accelerated_value;
-    
-    // Ultra-fast calculation dispatch - branch prediction optimized
-    if (cfg->level == 1) {
-        // Level 1: Use simple calculation from dedicated file
-        accelerated_value = accel_simple_calculate(cfg, input_value, event->code);
-    } else {
-        // Level 2: Use standard calculation from dedicated file
-        accelerated_value = accel_standard_calculate(cfg, data, input_value, event->code);
-    }
+    ACCEL_TRACE(cfg, "enter", event->code, event->value);
     
-    // Minimal safety check - emergency brake only
-    if (__builtin_expect(abs(accelerated_value) > EMERGENCY_BRAKE_THRESHOLD, 0)) {
-        // Unlikely path - extreme values
-        accelerated_value = (accelerated_value > 0) ? EMERGENCY_BRAKE_LIMIT : -EMERGENCY_BRAKE_LIMIT;
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_DEFERRED)
+    // Queue the raw event; the worker reports the processed one from this device
+    if (accel_deferred_enqueue(data, event->code, event->value, event->sync) == 0) {
+        ACCEL_TRACE(cfg, "exit", event->code, 0);
+        return ZMK_INPUT_PROC_STOP;
     }
+    // Not attached (init failed): the event passes through unprocessed
+#elif defined(CONFIG_INPUT_PROCESSOR_ACCEL_BUDGET)
+    // Measured run; repeated overruns switch Level 2 to the table path
+    event->value = accel_budget_run(cfg, data, event->code, event->value, event->sync);
+#else
+    // Run the instance's stage chain (resolved at init from its config)
+    event->value = accel_pipeline_run(cfg, data, event->code, event->value, event->sync);
+#endif
     
-    // Minimum movement guarantee - optimized
-    if (__builtin_expect(input_value != 0 && accelerated_value == 0, 0)) {
-        accelerated_value = (input_value > 0) ? 1 : -1;
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_TRANSFORM) && !defined(CONFIG_INPUT_PROCESSOR_ACCEL_DEFERRED)
+    // Other-axis term that this event's report can no longer carry
+    int32_t cross = accel_transform_take_cross(data);
+    if (cross != 0) {
+        uint16_t cross_code = (event->code == INPUT_REL_X) ? INPUT_REL_Y : INPUT_REL_X;
+        input_report(dev, cfg->input_type, cross_code, cross, true, K_NO_WAIT);
     }
-    
-    // Final safety validation before updating event (no logging in interrupt context)
-    if (__builtin_expect(abs(accelerated_value) > INT16_MAX, 0)) {
-        // Emergency clamp without logging to maintain real-time performance
-        accelerated_value = (accelerated_value > 0) ? INT16_MAX : INT16_MIN;
-    }
-    
-    // Update event value - single assignment with final validation
-    event->value = accelerated_value;
+#endif
+
+    ACCEL_TRACE(cfg, "exit", event->code, event->value);
     
     return ZMK_INPUT_PROC_CONTINUE;
 }
@@ -0,0 +1,322 @@
+// input_processor_accel_pipeline.c - Per-instance processing stage chain
+// Stages are resolved once at init, so disabled features cost no branches
+//
+// Copyright (c) 2024 The ZMK Contributors
+// Modifications (c) 2025 NUOVOTAKA
+// SPDX-License-Identifier: MIT
+
+#include <zephyr/logging/log.h>
+#include <zephyr/input/input.h>
+#include <stdlib.h>
+#include "../include/drivers/input_processor_accel.h"
+
+LOG_MODULE_DECLARE(input_processor_accel);
+
+// =============================================================================
+// STAGES
+// =============================================================================
+
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_BURST_TIMING)
+// Report boundaries drive burst-aware timestamps (zero events included)
+static bool accel_stage_burst(struct accel_stage_ctx *ctx) {
+    accel_burst_track_event(ctx->data, ctx->sync);
+    return true;
+}
+#endif
+
+// Zero filter, DPI pre-scale and input clamping
+static bool accel_stage_filter(struct accel_stage_ctx *ctx) {
+    int32_t raw_value = ctx->value;
+
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_WIDE_RANGE)
+    // Normalize high-DPI counts before the clamps (remainder kept per axis)
+    if (raw_value != 0) {
+        raw_value = accel_dpi_prescale(ctx->cfg, ctx->data, ctx->code, raw_value);
+    }
+#endif
+
+    // Check for zero movement (no acceleration needed)
+    if (raw_value == 0) {
+        ctx->value = 0;
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_TRANSFORM)
+        // Rotation can still move an axis whose own delta is zero
+        ctx->value = accel_transform_event(ctx->cfg, ctx->data, ctx->code, 0, ctx->sync);
+#endif
+        return false;
+    }
+
+    // Fast input clamping
+    ctx->input = accel_clamp_input_value(raw_value);
+    ctx->calc_input = ctx->input;
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_OVERFLOW_CARRY)
+    // Keep fast flicks inside the calc functions' accepted range instead of
+    // letting them be clamped or rejected; the result is scaled back below
+    ctx->calc_input = ACCEL_CLAMP(ctx->input, -MAX_REASONABLE_INPUT, MAX_REASONABLE_INPUT);
+#endif
+    return true;
+}
+
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_OVERFLOW_CARRY)
+static inline void accel_stage_scale_back(struct accel_stage_ctx *ctx) {
+    if (__builtin_expect(ctx->calc_input != ctx->input, 0)) {
+        // Same gain for the whole delta (|accelerated| <= INT16_MAX, |input| <= 2000)
+        ctx->value = ctx->value * ctx->input / ctx->calc_input;
+    }
+}
+#endif
+
+// Level 1: sensitivity and input-size curve
+static bool accel_stage_simple(struct accel_stage_ctx *ctx) {
+    ctx->value = accel_simple_calculate(ctx->cfg, ctx->calc_input, ctx->code);
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_OVERFLOW_CARRY)
+    accel_stage_scale_back(ctx);
+#endif
+    return true;
+}
+
+// Level 2: speed estimate, speed curve and Y boost
+static bool accel_stage_standard(struct accel_stage_ctx *ctx) {
+    ctx->value = accel_standard_calculate(ctx->cfg, ctx->data, ctx->calc_input, ctx->code);
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_OVERFLOW_CARRY)
+    accel_stage_scale_back(ctx);
+#endif
+    return true;
+}
+
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_BUDGET)
+// Level 2 under the latency budget: table lookup while degraded
+static bool accel_stage_standard_budget(struct accel_stage_ctx *ctx) {
+    if (!ctx->data->budget_fast) {
+        return accel_stage_standard(ctx);
+    }
+    ctx->value = accel_budget_lut_calculate(ctx->cfg, ctx->data, ctx->calc_input, ctx->code);
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_OVERFLOW_CARRY)
+    accel_stage_scale_back(ctx);
+#endif
+    return true;
+}
+#endif
+
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_TRANSFORM)
+// Rotation / per-axis gain / shear on the accelerated output
+static bool accel_stage_transform(struct accel_stage_ctx *ctx) {
+    ctx->value = accel_transform_event(ctx->cfg, ctx->data, ctx->code, ctx->value, ctx->sync);
+    return true;
+}
+#endif
+
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_OVERFLOW_CARRY)
+// Bounded output, excess carried into the next reports
+static bool accel_stage_carry(struct accel_stage_ctx *ctx) {
+    ctx->value = accel_carry_apply(ctx->data, ctx->code, ctx->value);
+    return true;
+}
+#else
+// Minimal safety check - emergency brake only
+static bool accel_stage_brake(struct accel_stage_ctx *ctx) {
+    if (__builtin_expect(abs(ctx->value) > EMERGENCY_BRAKE_THRESHOLD, 0)) {
+        ctx->value = (ctx->value > 0) ? EMERGENCY_BRAKE_LIMIT : -EMERGENCY_BRAKE_LIMIT;
+    }
+    return true;
+}
+#endif
+
+// Minimum movement guarantee
+static bool accel_stage_min_movement(struct accel_stage_ctx *ctx) {
+    if (__builtin_expect(ctx->input != 0 && ctx->value == 0, 0)) {
+        ctx->value = (ctx->input > 0) ? 1 : -1;
+    }
+    return true;
+}
+
+#if !defined(CONFIG_INPUT_PROCESSOR_ACCEL_FAST_PATH)
+// Final int16 range clamp (no logging in interrupt context)
+static bool accel_stage_clamp(struct accel_stage_ctx *ctx) {
+    if (__builtin_expect(abs(ctx->value) > INT16_MAX, 0)) {
+        ctx->value = (ctx->value > 0) ? INT16_MAX : INT16_MIN;
+    }
+    return true;
+}
+#endif
+
+// =============================================================================
+// CHAIN CONSTRUCTION AND EXECUTION
+// =============================================================================
+
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_CONST_CONFIG)
+// The chains accel_pipeline_build() resolves (this mode has no transform),
+// shared by all instances of a level and kept in flash
+#define ACCEL_PIPELINE_CONST_CHAIN(level_stage)                                                  \
+    {                                                                                           \
+        IF_ENABLED(CONFIG_INPUT_PROCESSOR_ACCEL_BURST_TIMING, (accel_stage_burst,))             \
+        accel_stage_filter,                                                                     \
+        level_stage,                                                                            \
+        COND_CODE_1(CONFIG_INPUT_PROCESSOR_ACCEL_OVERFLOW_CARRY,                                \
+                    (accel_stage_carry), (accel_stage_brake)),                                  \
+        accel_stage_min_movement,                                                               \
+        COND_CODE_1(CONFIG_INPUT_PROCESSOR_ACCEL_FAST_PATH, (), (accel_stage_clamp,))           \
+    }
+
+const accel_stage_fn accel_pipeline_level1[] = ACCEL_PIPELINE_CONST_CHAIN(accel_stage_simple);
+const accel_stage_fn accel_pipeline_level2[] = ACCEL_PIPELINE_CONST_CHAIN(
+    COND_CODE_1(CONFIG_INPUT_PROCESSOR_ACCEL_BUDGET,
+                (accel_stage_standard_budget), (accel_stage_standard)));
+
+int accel_pipeline_build(struct accel_config *cfg) {
+    if (!cfg) {
+        return ACCEL_ERR_INVALID_ARG;
+    }
+    cfg->stages = (cfg->level == 1) ? accel_pipeline_level1 : accel_pipeline_level2;
+    cfg->stage_count = ACCEL_PIPELINE_CONST_STAGES;
+    return 0;
+}
+#else
+static void accel_pipeline_add(struct accel_config *cfg, accel_stage_fn stage, int *ret) {
+    if (cfg->stage_count >= ACCEL_MAX_STAGES) {
+        LOG_ERR("Pipeline full (%d stages)", ACCEL_MAX_STAGES);
+        *ret = ACCEL_ERR_NO_MEMORY;
+        return;
+    }
+    cfg->stages[cfg->stage_count++] = stage;
+}
+
+int accel_pipeline_build(struct accel_config *cfg) {
+    if (!cfg) {
+        return ACCEL_ERR_INVALID_ARG;
+    }
+
+    int ret = 0;
+    cfg->stage_count = 0;
+
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_BURST_TIMING)
+    accel_pipeline_add(cfg, accel_stage_burst, &ret);
+#endif
+    accel_pipeline_add(cfg, accel_stage_filter, &ret);
+    accel_stage_fn level_stage = accel_stage_standard;
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_BUDGET)
+    level_stage = accel_stage_standard_budget;
+#endif
+    accel_pipeline_add(cfg, (cfg->level == 1) ? accel_stage_simple : level_stage, &ret);
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_TRANSFORM)
+    if (cfg->transform_active) {
+        accel_pipeline_add(cfg, accel_stage_transform, &ret);
+    }
+#endif
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_OVERFLOW_CARRY)
+    accel_pipeline_add(cfg, accel_stage_carry, &ret);
+#else
+    accel_pipeline_add(cfg, accel_stage_brake, &ret);
+#endif
+    bool min_movement = true;
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_TRANSFORM)
+    // A non-identity transform keeps sub-count remainders instead
+    min_movement = !cfg->transform_active;
+#endif
+    if (min_movement) {
+        accel_pipeline_add(cfg, accel_stage_min_movement, &ret);
+    }
+    // The brake / carry stage already bounds the output; the fast path drops the clamp
+#if !defined(CONFIG_INPUT_PROCESSOR_ACCEL_FAST_PATH)
+    accel_pipeline_add(cfg, accel_stage_clamp, &ret);
+#endif
+
+    if (ret < 0) {
+        return ret;
+    }
+
+    LOG_DBG("Pipeline built: %u stages", cfg->stage_count);
+    return 0;
+}
+#endif // CONFIG_INPUT_PROCESSOR_ACCEL_CONST_CONFIG
+
+int32_t accel_pipeline_run(const struct accel_config *cfg, struct accel_data *data,
+                           uint16_t code, int32_t value, bool sync) {
+    struct accel_stage_ctx ctx = {
+        .cfg = cfg,
+        .data = data,
+        .code = code,
+        .sync = sync,
+        .value = value,
+    };
+    for (uint8_t i = 0; i < cfg->stage_count; i++) {
+        if (!cfg->stages[i](&ctx)) {
+            break;
+        }
+    }
+    return ctx.value;
+}
+
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_XY_KERNEL)
+#if !defined(CONFIG_INPUT_PROCESSOR_ACCEL_BURST_TIMING) && !defined(CONFIG_INPUT_PROCESSOR_ACCEL_WIDE_RANGE)
+// Level stages accel_xy_level() can stand in for
+static bool accel_stage_packable(const struct accel_data *data, accel_stage_fn stage) {
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_BUDGET)
+    if (stage == accel_stage_standard_budget) {
+        return !data->budget_fast;
+    }
+#else
+    ARG_UNUSED(data);
+#endif
+    return stage == accel_stage_simple || stage == accel_stage_standard;
+}
+#endif
+
+bool accel_pipeline_run_xy(const struct accel_config *cfg, struct accel_data *data,
+                           int32_t *x, int32_t *y, bool sync) {
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_BURST_TIMING) || defined(CONFIG_INPUT_PROCESSOR_ACCEL_WIDE_RANGE)
+    // Y's burst tracking would run before X's speed update, and the
+    // pre-scale can turn a delta into zero after the filter has started
+    ARG_UNUSED(cfg);
+    ARG_UNUSED(data);
+    ARG_UNUSED(x);
+    ARG_UNUSED(y);
+    ARG_UNUSED(sync);
+    return false;
+#else
+    if (*x == 0 || *y == 0) {
+        return false;
+    }
+
+    // Everything before the level stage is the filter, which has no side
+    // effects on a non-zero delta, so Y's can run ahead of X's later stages
+    uint8_t level = 0;
+    while (level < cfg->stage_count && !accel_stage_packable(data, cfg->stages[level])) {
+        level++;
+    }
+    if (level == cfg->stage_count) {
+        return false;
+    }
+
+    struct accel_stage_ctx ctx[2] = {
+        {.cfg = cfg, .data = data, .code = INPUT_REL_X, .sync = false, .value = *x},
+        {.cfg = cfg, .data = data, .code = INPUT_REL_Y, .sync = sync, .value = *y},
+    };
+    for (int axis = 0; axis < 2; axis++) {
+        for (uint8_t i = 0; i < level; i++) {
+            cfg->stages[i](&ctx[axis]);
+        }
+    }
+
+    // Speed state is updated for X then Y, as two level stages would
+    int32_t in[2] = {ctx[0].calc_input, ctx[1].calc_input};
+    int32_t out[2];
+    accel_xy_level(cfg, data, in, out);
+
+    for (int axis = 0; axis < 2; axis++) {
+        ctx[axis].value = out[axis];
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_OVERFLOW_CARRY)
+        accel_stage_scale_back(&ctx[axis]);
+#endif
+        for (uint8_t i = level + 1; i < cfg->stage_count; i++) {
+            if (!cfg->stages[i](&ctx[axis])) {
+                break;
+            }
+        }
+    }
+
+    *x = ctx[0].value;
+    *y = ctx[1].value;
+    return true;
+#endif
+}
+#endif // CONFIG_INPUT_PROCESSOR_ACCEL_XY_KERNEL
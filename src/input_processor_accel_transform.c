@@ -0,0 +1,97 @@
+// input_processor_accel_transform.c - 2x2 output transform stage
+// Sensor rotation, per-axis gain and shear in the acceleration pass
+//
+// Copyright (c) 2024 The ZMK Contributors
+// Modifications (c) 2025 NUOVOTAKA
+// SPDX-License-Identifier: MIT
+
+#include <zephyr/logging/log.h>
+#include <zephyr/kernel.h>
+#include <zephyr/input/input.h>
+#include "../include/drivers/input_processor_accel.h"
+
+LOG_MODULE_DECLARE(input_processor_accel);
+
+// =============================================================================
+// CONFIGURATION
+// =============================================================================
+
+void accel_transform_set(struct accel_config *cfg, int32_t m00, int32_t m01,
+                         int32_t m10, int32_t m11) {
+    if (!cfg) {
+        return;
+    }
+
+    cfg->transform[0] = (int16_t)ACCEL_CLAMP(m00, -ACCEL_TRANSFORM_MAX, ACCEL_TRANSFORM_MAX);
+    cfg->transform[1] = (int16_t)ACCEL_CLAMP(m01, -ACCEL_TRANSFORM_MAX, ACCEL_TRANSFORM_MAX);
+    cfg->transform[2] = (int16_t)ACCEL_CLAMP(m10, -ACCEL_TRANSFORM_MAX, ACCEL_TRANSFORM_MAX);
+    cfg->transform[3] = (int16_t)ACCEL_CLAMP(m11, -ACCEL_TRANSFORM_MAX, ACCEL_TRANSFORM_MAX);
+
+    // Identity keeps the original single-axis behavior (no extra state used)
+    cfg->transform_active = !(cfg->transform[0] == SENSITIVITY_SCALE && cfg->transform[1] == 0 &&
+                              cfg->transform[2] == 0 && cfg->transform[3] == SENSITIVITY_SCALE);
+
+    LOG_INF("Transform matrix: [%d %d; %d %d]", cfg->transform[0], cfg->transform[1],
+            cfg->transform[2], cfg->transform[3]);
+}
+
+// =============================================================================
+// TRANSFORM STAGE
+// =============================================================================
+
+/**
+ * @brief Convert a thousandths sum to counts, keeping the remainder per axis
+ */
+static int32_t accel_transform_emit(struct accel_data *data, uint8_t axis, int64_t milli) {
+    milli += data->xform_rem[axis];
+    int64_t out = milli / SENSITIVITY_SCALE;
+    data->xform_rem[axis] = (int16_t)(milli - out * SENSITIVITY_SCALE);
+    return (int32_t)out;
+}
+
+int32_t accel_transform_event(const struct accel_config *cfg, struct accel_data *data,
+                              uint16_t code, int32_t value, bool sync) {
+    if (!cfg->transform_active || (code != INPUT_REL_X && code != INPUT_REL_Y)) {
+        return value;
+    }
+
+    int32_t out;
+
+    if (code == INPUT_REL_X) {
+        out = accel_transform_emit(data, 0, (int64_t)cfg->transform[0] * value);
+        if (sync) {
+            // X-only report: no Y event will carry the X->Y term
+            data->xform_cross = accel_transform_emit(data, 1, (int64_t)cfg->transform[2] * value);
+            data->xform_cur_x = 0;
+        } else {
+            data->xform_cur_x = value;
+        }
+    } else {
+        // X of this report was seen first (0 if the report had no X event)
+        out = accel_transform_emit(data, 1, (int64_t)cfg->transform[2] * data->xform_cur_x + (int64_t)cfg->transform[3] * value);
+        // X of this report already went out: the Y->X term is reported apart
+        data->xform_cross = accel_transform_emit(data, 0, (int64_t)cfg->transform[1] * value);
+        data->xform_cur_x = 0;
+    }
+
+    return out;
+}
+
+int32_t accel_transform_take_cross(struct accel_data *data) {
+    int32_t cross = data->xform_cross;
+    data->xform_cross = 0;
+    return (int32_t)ACCEL_CLAMP(cross, INT16_MIN, INT16_MAX);
+}
+
+void accel_transform_xy(const struct accel_config *cfg, struct accel_data *data,
+                        int32_t *x, int32_t *y) {
+    if (!cfg->transform_active) {
+        return;
+    }
+
+    int32_t in_x = *x;
+    int32_t in_y = *y;
+
+    *x = accel_transform_emit(data, 0, (int64_t)cfg->transform[0] * in_x + (int64_t)cfg->transform[1] * in_y);
+    *y = accel_transform_emit(data, 1, (int64_t)cfg->transform[2] * in_x + (int64_t)cfg->transform[3] * in_y);
+}
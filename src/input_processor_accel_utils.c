@@ -4,8 +4,10 @@
 #include <zephyr/logging/log.h>
 #include <zephyr/kernel.h>
 #include <zephyr/sys/atomic.h>
+#include <zephyr/input/input.h>
 #include <stdlib.h>
 #include "../include/drivers/input_processor_accel.h"
+#include "config/accel_config_adapter.h"
 
 LOG_MODULE_DECLARE(input_processor_accel);
 
@@ -18,28 +20,24 @@ LOG_MODULE_DECLARE(input_processor_accel);
 uint32_t accel_safe_quadratic_curve(int32_t abs_input, uint32_t multiplier) {
     // Enhanced safety: Input validation
     if (abs_input < 0) {
-        LOG_ERR("Invalid negative input to quadratic curve: %d", abs_input);
         return SENSITIVITY_SCALE; // Return 1.0x factor
     }
     
     // Enhanced safety: Multiplier validation
     if (multiplier == 0 || multiplier > 1000) {
-        LOG_ERR("Invalid multiplier for quadratic curve: %u", multiplier);
         return SENSITIVITY_SCALE; // Return 1.0x factor
     }
     
     // Enhanced safety: Prevent overflow with more conservative limit
     const uint32_t max_safe_input = QUADRATIC_SAFE_INPUT_LIMIT;  // More conservative for Level 1
     
-    if (abs_input > max_safe_input) {
-        LOG_DBG("Clamping input %d to safe limit %u", abs_input, max_safe_input);
+    if ((uint32_t)abs_input > max_safe_input) {
         abs_input = max_safe_input;
     }
     
     // Enhanced safety: Check for potential overflow before calculation
     if (abs_input > 0 && multiplier > UINT32_MAX / (abs_input * abs_input)) {
-        LOG_WRN("Potential overflow detected, using conservative calculation");
-        // Use linear approximation instead
+        // Potential overflow: use linear approximation instead
         uint32_t linear_result = SENSITIVITY_SCALE + (abs_input * multiplier / QUADRATIC_LINEAR_DIVISOR);
         return ACCEL_CLAMP(linear_result, SENSITIVITY_SCALE, MAX_SAFE_FACTOR);
     }
@@ -49,7 +47,6 @@ uint32_t accel_safe_quadratic_curve(int32_t abs_input, uint32_t multiplier) {
     
     // Enhanced safety: More conservative overflow check
     if (temp > (UINT32_MAX - SENSITIVITY_SCALE) / QUADRATIC_SCALE_DIVISOR) {
-        LOG_WRN("Quadratic result too large, using maximum safe value");
         return MAX_SAFE_FACTOR;
     }
     
@@ -61,8 +58,6 @@ uint32_t accel_safe_quadratic_curve(int32_t abs_input, uint32_t multiplier) {
     
     // Enhanced safety: Sanity check - result should be reasonable
     if (final_result > SENSITIVITY_SCALE * FALLBACK_MAX_ACCEL_LIMIT) { // Max acceleration limit
-        LOG_WRN("Quadratic curve result %u seems excessive for input %d, limiting to %dx", 
-                final_result, abs_input, FALLBACK_MAX_ACCEL_LIMIT);
         final_result = SENSITIVITY_SCALE * FALLBACK_MAX_ACCEL_LIMIT;
     }
     
@@ -73,6 +68,145 @@ uint32_t accel_safe_quadratic_curve(int32_t abs_input, uint32_t multiplier) {
 // TIMING FUNCTIONS
 // =============================================================================
 
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_CLOCK_HOOK)
+// NULL: kernel uptime
+static const struct accel_clock *accel_clock_source;
+
+int accel_set_clock(const struct accel_clock *clock) {
+    if (clock && (!clock->uptime_ms || !clock->uptime_us)) {
+        return -EINVAL;
+    }
+    accel_clock_source = clock;
+    return 0;
+}
+
+uint32_t accel_clock_ms(void) {
+    const struct accel_clock *clock = accel_clock_source;
+    return clock ? clock->uptime_ms(clock->user_data) : k_uptime_get_32();
+}
+
+uint32_t accel_clock_us(void) {
+    const struct accel_clock *clock = accel_clock_source;
+    if (clock) {
+        return clock->uptime_us(clock->user_data);
+    }
+    // Tick-based microseconds; wraps every ~71 minutes, deltas stay valid
+    return (uint32_t)k_ticks_to_us_floor64(k_uptime_ticks());
+}
+#endif // CONFIG_INPUT_PROCESSOR_ACCEL_CLOCK_HOOK
+
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_ADAPTIVE_RATE)
+static uint16_t accel_rate_median(const struct accel_data *data) {
+    uint16_t sorted[ACCEL_RATE_WINDOW_SIZE];
+    uint8_t count = data->interval_count;
+
+    // Insertion sort - at most 5 entries (indexed access, struct is packed)
+    for (uint8_t i = 0; i < count; i++) {
+        uint16_t value = data->interval_samples[i];
+        uint8_t j = i;
+        while (j > 0 && sorted[j - 1] > value) {
+            sorted[j] = sorted[j - 1];
+            j--;
+        }
+        sorted[j] = value;
+    }
+    return sorted[count / 2];
+}
+
+/**
+ * @brief Feed one inter-event delta into the report interval estimator
+ * @param data Acceleration data structure (caller holds the critical section)
+ * @param delta_us Time since the previous event
+ * @return Interval to use for speed calculation, 0 if no estimate exists yet
+ */
+static uint32_t accel_rate_effective_interval(struct accel_data *data, uint32_t delta_us) {
+    // Only plausible report intervals enter the median window
+    if (delta_us >= ACCEL_RATE_MIN_INTERVAL_US && delta_us <= ACCEL_RATE_MAX_INTERVAL_US) {
+        data->interval_samples[data->interval_index] = (uint16_t)delta_us;
+        data->interval_index = (data->interval_index + 1) % ACCEL_RATE_WINDOW_SIZE;
+        if (data->interval_count < ACCEL_RATE_WINDOW_SIZE) {
+            data->interval_count++;
+        }
+        data->report_interval_us = accel_rate_median(data);
+    }
+
+    uint32_t interval_us = data->report_interval_us;
+    if (interval_us == 0) {
+        return delta_us >= ACCEL_RATE_MIN_INTERVAL_US ? delta_us : 0;
+    }
+
+    // Sensors only report while moving: anything up to two intervals is jitter
+    // (or the second axis of the same report), longer gaps are real pauses
+    return (delta_us < interval_us * 2) ? interval_us : delta_us;
+}
+
+static uint16_t accel_rate_scaled_alpha(uint32_t interval_us) {
+    // Keep the EMA time constant fixed: more reports per second, smaller steps
+    uint32_t alpha = (uint32_t)SPEED_MOVING_AVERAGE_ALPHA * interval_us / ACCEL_RATE_REFERENCE_US;
+    return (uint16_t)ACCEL_CLAMP(alpha, ACCEL_RATE_MIN_ALPHA, SPEED_MOVING_AVERAGE_BASE);
+}
+#endif // CONFIG_INPUT_PROCESSOR_ACCEL_ADAPTIVE_RATE
+
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_BURST_TIMING)
+/**
+ * @brief Burst-aware timestamp of the current report
+ * BLE split peripherals deliver several sensor reports per connection event.
+ * Reports arriving within one burst are spread evenly over the observed
+ * connection interval, so the speed calculation sees the sensor's cadence
+ * instead of alternating 0 ms / 30 ms deltas.
+ * @param data Acceleration data structure (caller holds the critical section)
+ * @param arrival_us Arrival time of the current event
+ * @return Timestamp to use for the current event
+ */
+static uint32_t accel_burst_timestamp(struct accel_data *data, uint32_t arrival_us) {
+    // Second axis of a report shares the report's timestamp
+    if (data->frame_open) {
+        return data->virtual_time_us;
+    }
+    data->frame_open = 1;
+
+    // Driver-supplied sample time wins, but never moves time backwards
+    if (data->sample_time_valid) {
+        data->sample_time_valid = 0;
+        if ((int32_t)(data->sample_time_us - data->virtual_time_us) > 0) {
+            data->virtual_time_us = data->sample_time_us;
+        }
+        return data->virtual_time_us;
+    }
+
+    uint32_t since_burst_us = arrival_us - data->burst_start_us;
+    if (since_burst_us < ACCEL_BURST_WINDOW_US) {
+        if (data->burst_reports < ACCEL_BURST_MAX_REPORTS) {
+            data->burst_reports++;
+        }
+    } else {
+        // New burst: the previous one tells us the connection interval and burst size
+        if (since_burst_us <= ACCEL_RATE_MAX_INTERVAL_US) {
+            data->conn_interval_us = (data->conn_interval_us == 0) ? (uint16_t)since_burst_us :
+                (uint16_t)((data->conn_interval_us * 3U + since_burst_us) / 4U);
+        }
+        data->burst_size = data->burst_reports;
+        data->burst_reports = 1;
+        data->burst_start_us = arrival_us;
+    }
+
+    uint32_t spacing_us = (data->burst_size > 1) ? data->conn_interval_us / data->burst_size : 0;
+    int32_t lag_us = (int32_t)(arrival_us - data->virtual_time_us);
+
+    if (spacing_us == 0 || lag_us >= (int32_t)spacing_us) {
+        // Not bursting, or the spread timeline fell behind real time
+        data->virtual_time_us = arrival_us;
+    } else {
+        // Inside a burst: advance by one report spacing, at most one interval ahead
+        data->virtual_time_us += spacing_us;
+        if ((int32_t)(data->virtual_time_us - arrival_us) > (int32_t)data->conn_interval_us) {
+            data->virtual_time_us = arrival_us + data->conn_interval_us;
+        }
+    }
+    return data->virtual_time_us;
+}
+#endif // CONFIG_INPUT_PROCESSOR_ACCEL_BURST_TIMING
+
 /**
  * @brief Simplified speed calculation - no accumulation risk
  * @param data Acceleration data structure
@@ -83,7 +217,6 @@ uint32_t accel_safe_quadratic_curve(int32_t abs_input, uint32_t multiplier) {
 // Uses minimal critical section with irq_lock for maximum safety
 uint32_t accel_calculate_simple_speed(struct accel_data *data, int32_t input_value) {
     if (!data) {
-        LOG_ERR("Data pointer is NULL in speed calculation");
         return abs(input_value) * ACCEL_SPEED_SCALE_FACTOR; // Graceful degradation: simple fallback
     }
     
@@ -96,43 +229,68 @@ uint32_t accel_calculate_simple_speed(struct accel_data *data, int32_t input_val
     // Minimal critical section for data consistency
     unsigned int key = irq_lock();
     
-    uint32_t current_time_ms = k_uptime_get_32();
+    uint32_t current_time_ms = accel_event_time_ms(data);
     uint32_t last_time_ms = data->last_time_ms;
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_ADAPTIVE_RATE)
+    uint32_t current_time_us = accel_event_time_us(data);
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_BURST_TIMING)
+    current_time_us = accel_burst_timestamp(data, current_time_us);
+#endif
+#endif
     
     // Handle first call or time overflow (still in critical section)
     if (last_time_ms == 0 || current_time_ms < last_time_ms) {
-        uint16_t initial_speed = abs_input * ACCEL_SPEED_SCALE_FACTOR;
+        accel_speed_t initial_speed = abs_input * ACCEL_SPEED_SCALE_FACTOR;
         data->last_time_ms = current_time_ms;
         data->recent_speed = initial_speed;
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_ADAPTIVE_RATE)
+        data->last_time_us = current_time_us;
+#endif
         irq_unlock(key); // Release critical section
         return initial_speed;
     }
     
     uint32_t time_delta_ms = current_time_ms - last_time_ms;
-    uint16_t current_speed;
+    accel_speed_t current_speed;
+    uint16_t alpha = SPEED_MOVING_AVERAGE_ALPHA; // Alpha value in thousandths
     
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_ADAPTIVE_RATE)
+    uint32_t interval_us = 0;
+    if (time_delta_ms < SPEED_CALC_TIME_LIMIT_MS) {
+        int32_t delta_us = (int32_t)(current_time_us - data->last_time_us);
+        interval_us = accel_rate_effective_interval(data, delta_us > 0 ? (uint32_t)delta_us : 0);
+    }
+    data->last_time_us = current_time_us;
+
+    if (interval_us > 0) {
+        // Speed from the estimated report interval (abs_input <= 2000, fits in 32 bits)
+        uint32_t temp_speed = (uint32_t)abs_input * 1000000U / interval_us;
+        current_speed = (temp_speed > ACCEL_SPEED_LIMIT) ? ACCEL_SPEED_LIMIT : (accel_speed_t)temp_speed;
+        alpha = accel_rate_scaled_alpha(interval_us);
+    } else
+#endif
     // **Fixed**: Correct speed calculation (counts per second) with overflow protection
     if (time_delta_ms > 0 && time_delta_ms < SPEED_CALC_TIME_LIMIT_MS) { // Within time limit
         // Speed = movement / time * 1000 (counts/sec)
         // Enhanced safety: Check for potential overflow before multiplication
-        if (abs_input > UINT32_MAX / SPEED_CALC_TIME_LIMIT_MS) {
-            current_speed = UINT16_MAX; // Cap at maximum
+        if ((uint32_t)abs_input > UINT32_MAX / SPEED_CALC_TIME_LIMIT_MS) {
+            current_speed = ACCEL_SPEED_LIMIT; // Cap at maximum
         } else {
             uint32_t temp_speed = (abs_input * SPEED_CALC_TIME_LIMIT_MS) / time_delta_ms;
-            current_speed = (temp_speed > UINT16_MAX) ? UINT16_MAX : (uint16_t)temp_speed;
+            current_speed = (temp_speed > ACCEL_SPEED_LIMIT) ? ACCEL_SPEED_LIMIT : (accel_speed_t)temp_speed;
         }
     } else {
         // Input-based estimation when time is too long
         // Enhanced safety: Prevent overflow in multiplication
         uint32_t temp_speed = (uint32_t)abs_input * ACCEL_SPEED_SCALE_FACTOR;
-        current_speed = (temp_speed > UINT16_MAX) ? UINT16_MAX : (uint16_t)temp_speed;
+        current_speed = (temp_speed > ACCEL_SPEED_LIMIT) ? ACCEL_SPEED_LIMIT : (accel_speed_t)temp_speed;
     }
     
     // Speed samples removed for memory optimization
     
     // Exponential moving average (smoother speed changes)
-    uint16_t alpha = SPEED_MOVING_AVERAGE_ALPHA; // Alpha value in thousandths
-    uint16_t averaged_speed = (data->recent_speed * (SPEED_MOVING_AVERAGE_BASE - alpha) + current_speed * alpha) / SPEED_MOVING_AVERAGE_BASE;
+    accel_speed_t averaged_speed = (accel_speed_t)(((accel_speed_acc_t)data->recent_speed * (SPEED_MOVING_AVERAGE_BASE - alpha) +
+                                                    (accel_speed_acc_t)current_speed * alpha) / SPEED_MOVING_AVERAGE_BASE);
     
     // Update state in critical section
     data->last_time_ms = current_time_ms;
@@ -143,12 +301,151 @@ uint32_t accel_calculate_simple_speed(struct accel_data *data, int32_t input_val
     return (uint32_t)averaged_speed;
 }
 
+uint16_t accel_get_report_interval_us(const struct device *dev) {
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_ADAPTIVE_RATE)
+    if (!dev || !dev->data) {
+        return 0;
+    }
+    const struct accel_data *data = dev->data;
+    return data->report_interval_us;
+#else
+    ARG_UNUSED(dev);
+    return 0;
+#endif
+}
+
+int accel_set_sample_time_us(const struct device *dev, uint32_t sample_time_us) {
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_BURST_TIMING)
+    if (!dev || !dev->data) {
+        return ACCEL_ERR_INVALID_ARG;
+    }
+    struct accel_data *data = dev->data;
+
+    unsigned int key = irq_lock();
+    data->sample_time_us = sample_time_us;
+    data->sample_time_valid = 1;
+    irq_unlock(key);
+    return 0;
+#else
+    ARG_UNUSED(dev);
+    ARG_UNUSED(sample_time_us);
+    return ACCEL_ERR_NOT_SUPPORTED;
+#endif
+}
+
+int accel_update_sensor_dpi(const struct device *dev, uint16_t sensor_dpi) {
+    if (!dev || !dev->config || !dev->data) {
+        return ACCEL_ERR_INVALID_ARG;
+    }
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_CONST_CONFIG)
+    // The configuration is const (flash); the DPI is fixed at build time
+    ARG_UNUSED(sensor_dpi);
+    return ACCEL_ERR_NOT_SUPPORTED;
+#else
+    struct accel_config *cfg = (struct accel_config *)dev->config;
+
+    // DPI and the adjusted sensitivity are replaced together
+    unsigned int key = irq_lock();
+    accel_set_sensor_dpi(cfg, sensor_dpi);
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_WIDE_RANGE)
+    struct accel_data *data = dev->data;
+    data->prescale_rem[0] = 0;
+    data->prescale_rem[1] = 0;
+#endif
+    irq_unlock(key);
+
+    LOG_INF("Sensor DPI changed to %u", cfg->sensor_dpi);
+    return 0;
+#endif
+}
+
+// =============================================================================
+// DPI PRE-SCALE (WIDE RANGE)
+// =============================================================================
+
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_WIDE_RANGE)
+/**
+ * @brief Normalize a delta above ACCEL_PRESCALE_DPI to that DPI before any clamping
+ * Sub-count remainders are kept per axis so slow motion is not lost.
+ * @param cfg Acceleration configuration
+ * @param data Acceleration data structure
+ * @param code Event code (only REL_X and REL_Y are scaled)
+ * @param value Raw sensor delta
+ * @return Delta in ACCEL_PRESCALE_DPI counts
+ */
+int32_t accel_dpi_prescale(const struct accel_config *cfg, struct accel_data *data,
+                           uint16_t code, int32_t value) {
+    // Only sensors above ACCEL_PRESCALE_DPI are pre-scaled (aligned word, no lock)
+    uint32_t prescale = cfg->prescale_q16;
+    if (prescale == 0 || (code != INPUT_REL_X && code != INPUT_REL_Y)) {
+        return value;
+    }
+
+    uint8_t axis = (code == INPUT_REL_X) ? 0 : 1;
+    int64_t scaled = (int64_t)value * prescale + data->prescale_rem[axis];
+    int32_t out = (int32_t)(scaled / (int64_t)ACCEL_DPI_SCALE_ONE);
+    data->prescale_rem[axis] = (int32_t)(scaled - (int64_t)out * (int64_t)ACCEL_DPI_SCALE_ONE);
+    return out;
+}
+#endif // CONFIG_INPUT_PROCESSOR_ACCEL_WIDE_RANGE
+
+// =============================================================================
+// OVERFLOW CARRY
+// =============================================================================
+
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_OVERFLOW_CARRY)
+/**
+ * @brief Bound per-report output and carry the excess into the next reports
+ * Output above EMERGENCY_BRAKE_THRESHOLD is limited to EMERGENCY_BRAKE_LIMIT
+ * like the emergency brake, but the remainder is kept in a per-axis backlog
+ * (bounded by CONFIG_INPUT_PROCESSOR_ACCEL_CARRY_LIMIT) instead of discarded.
+ * The backlog is dropped when the direction reverses or the axis goes idle.
+ * @param data Acceleration data structure
+ * @param code Event code (REL_X and REL_Y carry, other codes are only braked)
+ * @param value Accelerated value of the current event
+ * @return Value to emit for the current event
+ */
+int32_t accel_carry_apply(struct accel_data *data, uint16_t code, int32_t value) {
+    if (code != INPUT_REL_X && code != INPUT_REL_Y) {
+        // Scroll axes: emergency brake only
+        if (abs(value) > EMERGENCY_BRAKE_THRESHOLD) {
+            value = (value > 0) ? EMERGENCY_BRAKE_LIMIT : -EMERGENCY_BRAKE_LIMIT;
+        }
+        return value;
+    }
+
+    uint8_t axis = (code == INPUT_REL_X) ? 0 : 1;
+    uint32_t now_ms = accel_event_time_ms(data);
+    int32_t total = value;
+
+    // Stale or opposite-direction backlog no longer belongs to this motion
+    int32_t backlog = data->carry[axis];
+    // Each axis ages on its own: a steady X stream must not keep a Y backlog alive
+    if (backlog != 0 && (now_ms - data->carry_time_ms[axis]) <= ACCEL_CARRY_EXPIRY_MS &&
+        (backlog > 0) == (value > 0)) {
+        total += backlog;
+    }
+    data->carry_time_ms[axis] = now_ms;
+
+    int32_t emit = total;
+    if (abs(total) > EMERGENCY_BRAKE_THRESHOLD) {
+        emit = (total > 0) ? EMERGENCY_BRAKE_LIMIT : -EMERGENCY_BRAKE_LIMIT;
+    }
+    data->carry[axis] = (int16_t)ACCEL_CLAMP(total - emit, -CONFIG_INPUT_PROCESSOR_ACCEL_CARRY_LIMIT,
+                                             CONFIG_INPUT_PROCESSOR_ACCEL_CARRY_LIMIT);
+    return emit;
+}
+#endif // CONFIG_INPUT_PROCESSOR_ACCEL_OVERFLOW_CARRY
+
 // Enhanced safety: Safe fallback calculation for when Level 2 causes issues
-int32_t accel_safe_fallback_calculate(int32_t input_value, uint32_t max_factor) {
+int32_t accel_safe_fallback_calculate(const struct accel_config *cfg, int32_t input_value,
+                                      uint32_t max_factor) {
     if (input_value == 0) {
         return 0;
     }
     
+    ACCEL_TRACE(cfg, "fallback_start", 0, input_value);
+    
     // Enhanced safety: Input validation
     input_value = accel_clamp_input_value(input_value);
     int32_t abs_input = abs(input_value);
@@ -156,9 +453,6 @@ int32_t accel_safe_fallback_calculate(int32_t input_value, uint32_t max_factor)
     
     // Enhanced safety: Max factor validation
     uint32_t safe_max_factor = ACCEL_CLAMP(max_factor, SENSITIVITY_SCALE, MAX_SAFE_FACTOR);
-    if (safe_max_factor != max_factor) {
-        LOG_DBG("Fallback: Clamping max_factor from %u to %u", max_factor, safe_max_factor);
-    }
     
     // Enhanced safety: Simple linear acceleration based on input magnitude
     if (abs_input > FALLBACK_ACCEL_THRESHOLD) { // Lower threshold for more responsive fallback
@@ -176,7 +470,7 @@ int32_t accel_safe_fallback_calculate(int32_t input_value, uint32_t max_factor)
         
         // Enhanced safety: Safe multiplication with overflow check
         if (abs(input_value) > INT16_MAX * SENSITIVITY_SCALE / factor) {
-            LOG_WRN("Fallback: Would overflow, using linear scaling");
+            accel_log_event(cfg, ACCEL_LOG_OVERFLOW);
             result = input_value * CONSERVATIVE_FALLBACK_MULTIPLIER; // Simple scaling
         } else {
             int64_t temp = safe_multiply_64((int64_t)input_value, (int64_t)factor, 
@@ -191,11 +485,11 @@ int32_t accel_safe_fallback_calculate(int32_t input_value, uint32_t max_factor)
     
     // Enhanced safety: Sanity check
     if (abs(input_value) <= FALLBACK_SANITY_INPUT_LIMIT && abs(result) > abs(input_value) * SUSPICIOUS_RESULT_MULTIPLIER) {
-        LOG_WRN("Fallback: Suspicious result %d for input %d, using conservative", 
-                result, input_value);
+        accel_log_event(cfg, ACCEL_LOG_SUSPICIOUS);
         result = input_value * CONSERVATIVE_FALLBACK_MULTIPLIER; // Very conservative fallback
     }
     
+    ACCEL_TRACE(cfg, "fallback_end", 0, result);
     return result;
 }
 
@@ -0,0 +1,213 @@
+// input_processor_accel_xy.c - Dual-axis (X/Y) frame calculation
+// Applies the shared stages to both axes packed in one 32-bit word
+//
+// Copyright (c) 2024 The ZMK Contributors
+// Modifications (c) 2025 NUOVOTAKA
+// SPDX-License-Identifier: MIT
+
+#include <zephyr/logging/log.h>
+#include <zephyr/input/input.h>
+#include <stdlib.h>
+#include "../include/drivers/input_processor_accel.h"
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#include <arm_acle.h>
+#define ACCEL_XY_USE_DSP 1
+#endif
+
+LOG_MODULE_DECLARE(input_processor_accel);
+
+// =============================================================================
+// PACKED KERNEL
+// =============================================================================
+
+accel_xy_t accel_xy_scale(accel_xy_t xy, int32_t gain_x, int32_t gain_y) {
+    // Sign bit of each lane: the Q25 product floors, +1 on a negative lane
+    // turns that into the scalar path's truncation toward zero
+    int32_t neg_x = (int32_t)((xy >> 15) & 1);
+    int32_t neg_y = (int32_t)(xy >> 31);
+
+#if defined(ACCEL_XY_USE_DSP)
+    // SMULWB / SMULWT: 32-bit Q25 gain times the matching 16-bit half, >> 16
+    int32_t qx = (__smulwb(gain_x, (int32_t)xy) >> (ACCEL_XY_GAIN_SHIFT - 16)) + neg_x;
+    int32_t qy = (__smulwt(gain_y, (int32_t)xy) >> (ACCEL_XY_GAIN_SHIFT - 16)) + neg_y;
+
+    // SSAT to int16 (SSAT16 only narrows lanes that are already packed)
+    qx = __ssat(qx, 16);
+    qy = __ssat(qy, 16);
+#else
+    int32_t qx = (int32_t)(((int64_t)gain_x * accel_xy_get_x(xy)) >> ACCEL_XY_GAIN_SHIFT) + neg_x;
+    int32_t qy = (int32_t)(((int64_t)gain_y * accel_xy_get_y(xy)) >> ACCEL_XY_GAIN_SHIFT) + neg_y;
+
+    qx = ACCEL_CLAMP(qx, INT16_MIN, INT16_MAX);
+    qy = ACCEL_CLAMP(qy, INT16_MIN, INT16_MAX);
+#endif
+
+    // Repack (PKHBT on DSP targets)
+    return accel_xy_pack((int16_t)qx, (int16_t)qy);
+}
+
+// =============================================================================
+// PER-LANE FIXUPS (MATCH THE SCALAR PATH)
+// =============================================================================
+
+/**
+ * @brief Minimum movement guarantee: +/-1 if the sensitivity-scaled input was >= 0.5
+ */
+static inline int32_t accel_xy_min_movement(int32_t input_value, int32_t result, uint32_t sensitivity) {
+    if (input_value != 0 && result == 0) {
+        int64_t raw_result = (int64_t)input_value * (int64_t)sensitivity;
+        if (raw_result >= SENSITIVITY_SCALE / CONSERVATIVE_FALLBACK_MULTIPLIER ||
+            raw_result <= -(SENSITIVITY_SCALE / CONSERVATIVE_FALLBACK_MULTIPLIER)) {
+            return (raw_result > 0) ? 1 : -1;
+        }
+    }
+    return result;
+}
+
+// =============================================================================
+// LEVEL-SPECIFIC FRAME PATHS
+// =============================================================================
+
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_LEVEL_SIMPLE)
+static void accel_xy_simple(const struct accel_config *cfg, const int32_t in[2], int32_t out[2],
+                            uint32_t sensitivity) {
+    int16_t gain[2];
+    for (int axis = 0; axis < 2; axis++) {
+        int32_t abs_input = abs(in[axis]);
+        gain[axis] = (abs_input > 1 && abs_input <= MAX_SAFE_INPUT_VALUE) ?
+            (int16_t)accel_simple_curve_factor(cfg, abs_input) : SENSITIVITY_SCALE;
+    }
+
+    int32_t sens_q = accel_xy_gain((uint16_t)sensitivity);
+    accel_xy_t xy = accel_xy_pack((int16_t)in[0], (int16_t)in[1]);
+    xy = accel_xy_scale(xy, sens_q, sens_q);
+    xy = accel_xy_scale(xy, accel_xy_gain(gain[0]), accel_xy_gain(gain[1]));
+    out[0] = accel_xy_get_x(xy);
+    out[1] = accel_xy_get_y(xy);
+
+    for (int axis = 0; axis < 2; axis++) {
+        out[axis] = accel_xy_min_movement(in[axis], out[axis], sensitivity);
+
+        // Same sanity check as the scalar path
+        if (abs(in[axis]) <= 100 && abs(out[axis]) > 1000) {
+            out[axis] = safe_int32_to_int16(in[axis] * CONSERVATIVE_FALLBACK_MULTIPLIER);
+        }
+    }
+}
+#endif // CONFIG_INPUT_PROCESSOR_ACCEL_LEVEL_SIMPLE
+
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_LEVEL_STANDARD)
+static void accel_xy_standard(const struct accel_config *cfg, struct accel_data *data,
+                              const int32_t in[2], int32_t out[2], uint32_t sensitivity) {
+    int16_t gain[2] = {SENSITIVITY_SCALE, SENSITIVITY_SCALE};
+    bool fallback[2] = {false, false};
+
+    // Speed state is updated per axis in event order (X then Y)
+    for (int axis = 0; axis < 2; axis++) {
+        if (in[axis] == 0) {
+            continue;
+        }
+        if (data->recent_speed > ACCEL_SPEED_LIMIT / 2) {
+            data->recent_speed = 0;
+            data->last_time_ms = 0;
+        }
+        uint32_t speed = accel_calculate_simple_speed(data, in[axis]);
+        if (speed > MAX_REASONABLE_SPEED) {
+            fallback[axis] = true;
+            continue;
+        }
+        uint32_t factor = accel_standard_speed_factor(cfg, speed);
+        if (factor > SENSITIVITY_SCALE) {
+            gain[axis] = (int16_t)factor;
+        }
+    }
+
+    int32_t sens_q = accel_xy_gain((uint16_t)sensitivity);
+    accel_xy_t xy = accel_xy_pack((int16_t)in[0], (int16_t)in[1]);
+    xy = accel_xy_scale(xy, sens_q, sens_q);
+    xy = accel_xy_scale(xy, accel_xy_gain(gain[0]), accel_xy_gain(gain[1]));
+
+    uint16_t y_boost = accel_decode_y_boost(cfg->y_boost_scaled);
+    if (y_boost != SENSITIVITY_SCALE) {
+        xy = accel_xy_scale(xy, accel_xy_gain(SENSITIVITY_SCALE),
+                            accel_xy_gain((uint16_t)ACCEL_CLAMP(y_boost, 500, 3000)));
+    }
+    out[0] = accel_xy_get_x(xy);
+    out[1] = accel_xy_get_y(xy);
+
+    for (int axis = 0; axis < 2; axis++) {
+        if (in[axis] == 0) {
+            continue;
+        }
+        // Same fallbacks and sanity check as the scalar path
+        if (fallback[axis] || (abs(in[axis]) <= 50 && abs(out[axis]) > 2000)) {
+            out[axis] = accel_safe_fallback_calculate(cfg, in[axis], cfg->cfg.level2.max_factor);
+            continue;
+        }
+        out[axis] = accel_xy_min_movement(in[axis], out[axis], sensitivity);
+    }
+}
+#endif // CONFIG_INPUT_PROCESSOR_ACCEL_LEVEL_STANDARD
+
+// =============================================================================
+// FRAME API
+// =============================================================================
+
+void accel_xy_level(const struct accel_config *cfg, struct accel_data *data,
+                    const int32_t in[2], int32_t out[2]) {
+    // Packed path covers the normal operating range, where none of the
+    // scalar overflow guards can trigger
+    bool packed = abs(in[0]) <= MAX_REASONABLE_INPUT && abs(in[1]) <= MAX_REASONABLE_INPUT;
+    uint32_t sensitivity = accel_get_dpi_sensitivity(cfg);
+
+    out[0] = 0;
+    out[1] = 0;
+
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_LEVEL_SIMPLE)
+    if (packed && cfg->level == 1 &&
+        cfg->cfg.level1.sensitivity != 0 && cfg->cfg.level1.sensitivity <= MAX_SAFE_SENSITIVITY &&
+        sensitivity != 0 && sensitivity <= MAX_SAFE_SENSITIVITY) {
+        accel_xy_simple(cfg, in, out, sensitivity);
+        return;
+    }
+#endif
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_LEVEL_STANDARD)
+    if (packed && cfg->level == 2 && cfg->cfg.level2.min_factor <= MAX_SAFE_FACTOR &&
+        sensitivity != 0 && sensitivity <= MAX_SAFE_SENSITIVITY) {
+        accel_xy_standard(cfg, data, in, out, sensitivity);
+        return;
+    }
+#endif
+
+    // Scalar path, same order as the per-event chain
+    static const uint16_t codes[2] = {INPUT_REL_X, INPUT_REL_Y};
+    for (int axis = 0; axis < 2; axis++) {
+        if (in[axis] == 0) {
+            continue;
+        }
+        out[axis] = (cfg->level == 1) ? accel_simple_calculate(cfg, in[axis], codes[axis])
+                                      : accel_standard_calculate(cfg, data, in[axis], codes[axis]);
+    }
+}
+
+int accel_calculate_xy(const struct accel_config *cfg, struct accel_data *data,
+                       int32_t *x, int32_t *y) {
+    if (!cfg || !data || !x || !y) {
+        return ACCEL_ERR_INVALID_ARG;
+    }
+
+    int32_t in[2] = {*x, *y};
+    int32_t out[2];
+
+    accel_xy_level(cfg, data, in, out);
+
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_TRANSFORM)
+    // Both axes are known here, so the matrix is applied without delay
+    accel_transform_xy(cfg, data, &out[0], &out[1]);
+#endif
+
+    *x = out[0];
+    *y = out[1];
+    return 0;
+}
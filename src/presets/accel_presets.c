@@ -5,6 +5,8 @@
 #include <string.h>
 #include "../../include/drivers/input_processor_accel.h"
 #include "../config/accel_config.h"
+#include "../config/accel_config_adapter.h"
+#include "accel_presets.h"
 
 LOG_MODULE_DECLARE(input_processor_accel);
 
@@ -24,147 +26,40 @@ typedef struct {
     uint16_t sensor_dpi;         // Sensor DPI setting
 } preset_config_t;
 
+// One table entry from a value list in accel_presets.h
+#define ACCEL_PRESET_ENTRY(preset_name, ...)                                                     \
+    {                                                                                           \
+        .name = preset_name,                                                                    \
+        .sensitivity = ACCEL_PRESET_SENSITIVITY(__VA_ARGS__),                                   \
+        .max_factor = ACCEL_PRESET_MAX_FACTOR(__VA_ARGS__),                                     \
+        .curve_type = ACCEL_PRESET_CURVE_TYPE(__VA_ARGS__),                                     \
+        .y_boost = ACCEL_PRESET_Y_BOOST(__VA_ARGS__),                                           \
+        .speed_threshold = ACCEL_PRESET_SPEED_THRESHOLD(__VA_ARGS__),                           \
+        .speed_max = ACCEL_PRESET_SPEED_MAX(__VA_ARGS__),                                       \
+        .min_factor = ACCEL_PRESET_MIN_FACTOR(__VA_ARGS__),                                     \
+        .sensor_dpi = ACCEL_PRESET_SENSOR_DPI(__VA_ARGS__),                                     \
+    }
+
 static const preset_config_t presets[] = {
-    // Office presets
-    {
-        .name = "office_optical",
-        .sensitivity = 1000,      // 1.0x (800 DPI baseline)
-        .max_factor = 2200,       // 2.2x moderate acceleration
-        .curve_type = 1,          // Mild
-        .y_boost = 1080,          // 1.08x Y-axis enhancement
-        .speed_threshold = 700,   // Early acceleration start
-        .speed_max = 2600,        // Moderate maximum speed
-        .min_factor = 980,        // 0.98x precision control
+    // Office presets: moderate acceleration, stable response
+    ACCEL_PRESET_ENTRY("office_optical", ACCEL_PRESET_OFFICE_OPTICAL),
+    ACCEL_PRESET_ENTRY("office_laser", ACCEL_PRESET_OFFICE_LASER),       // Conservative (prevents cursor freeze)
+    ACCEL_PRESET_ENTRY("office_trackball", ACCEL_PRESET_OFFICE_TRACKBALL), // Low DPI compensation
+
+    // Gaming presets: strong curve, quick response
+    ACCEL_PRESET_ENTRY("gaming_optical", ACCEL_PRESET_GAMING_OPTICAL),
+    ACCEL_PRESET_ENTRY("gaming_laser", ACCEL_PRESET_GAMING_LASER),       // Ultra-high DPI compensation
+    ACCEL_PRESET_ENTRY("gaming_trackball", ACCEL_PRESET_GAMING_TRACKBALL),
+
+    // High sensitivity presets: strong acceleration, mild curve
+    ACCEL_PRESET_ENTRY("high_sens_optical", ACCEL_PRESET_HIGH_SENS_OPTICAL),
+    ACCEL_PRESET_ENTRY("high_sens_laser", ACCEL_PRESET_HIGH_SENS_LASER), // Ultra-high DPI compensation
+    ACCEL_PRESET_ENTRY("high_sens_trackball", ACCEL_PRESET_HIGH_SENS_TRACKBALL),
 
-        .sensor_dpi = 800         // Standard optical sensor
-    },
-    {
-        .name = "office_laser",
-        .sensitivity = 1000,      // 1.0x (conservative DPI adjustment)
-        .max_factor = 1500,       // 1.5x conservative acceleration (prevent cursor freeze)
-        .curve_type = 0,          // Linear (most predictable)
-        .y_boost = 1000,          // 1.0x Y-axis standard (avoid issues)
-        .speed_threshold = 1000,  // High threshold for stability
-        .speed_max = 2000,        // Low max speed for stability
-        .min_factor = 1000,       // 1.0x standard (avoid issues)
-        .sensor_dpi = 1600        // High precision laser
-    },
-    {
-        .name = "office_trackball",
-        .sensitivity = 1500,      // 1.5x (low DPI compensation)
-        .max_factor = 2000,       // 2.0x conservative acceleration
-        .curve_type = 1,          // Mild
-        .y_boost = 1100,          // 1.1x Y-axis enhancement
-        .speed_threshold = 800,   // Stable response
-        .speed_max = 2400,        // Moderate maximum speed
-        .min_factor = 950,        // 0.95x precision focus
-        .sensor_dpi = 400         // Low DPI trackball
-    },
-    
-    // Gaming presets
-    {
-        .name = "gaming_optical",
-        .sensitivity = 1000,      // 1.0x (1200 DPI baseline adjustment)
-        .max_factor = 2500,       // 2.5x aggressive acceleration
-        .curve_type = 2,          // Strong
-        .y_boost = 1120,          // 1.12x balance adjustment
-        .speed_threshold = 550,   // Quick response
-        .speed_max = 2800,        // High-speed movement support
-        .min_factor = 950,        // 0.95x precision aiming
-        .sensor_dpi = 1200        // Gaming optical sensor
-    },
-    {
-        .name = "gaming_laser",
-        .sensitivity = 600,       // 0.6x (ultra-high DPI compensation)
-        .max_factor = 2500,       // 2.5x aggressive acceleration
-        .curve_type = 2,          // Strong
-        .y_boost = 1120,          // 1.12x balance adjustment
-        .speed_threshold = 550,   // Quick response
-        .speed_max = 2800,        // High-speed movement support
-        .min_factor = 950,        // 0.95x precision aiming
-        .sensor_dpi = 3200        // High DPI laser
-    },
-    {
-        .name = "gaming_trackball",
-        .sensitivity = 1200,      // 1.2x (800 DPI adjustment)
-        .max_factor = 2300,       // 2.3x moderate acceleration
-        .curve_type = 2,          // Strong
-        .y_boost = 1150,          // 1.15x Y-axis enhancement
-        .speed_threshold = 600,   // Balanced response
-        .speed_max = 2700,        // High-speed movement
-        .min_factor = 940,        // 0.94x precision control
-        .sensor_dpi = 800         // High precision trackball
-    },
-    
-    // High sensitivity presets
-    {
-        .name = "high_sens_optical",
-        .sensitivity = 1100,      // 1.1x (1600 DPI adjustment)
-        .max_factor = 2800,       // 2.8x strong acceleration
-        .curve_type = 1,          // Mild (easier to control)
-        .y_boost = 1150,          // 1.15x Y-axis enhancement
-        .speed_threshold = 450,   // Immediate response
-        .speed_max = 2400,        // Moderate adjustment
-        .min_factor = 900,        // 0.9x precision focus
-        .sensor_dpi = 1600        // High precision optical sensor
-    },
-    {
-        .name = "high_sens_laser",
-        .sensitivity = 500,       // 0.5x (ultra-high DPI compensation)
-        .max_factor = 2800,       // 2.8x strong acceleration
-        .curve_type = 1,          // Mild (easier to control)
-        .y_boost = 1150,          // 1.15x Y-axis enhancement
-        .speed_threshold = 450,   // Immediate response
-        .speed_max = 2400,        // Moderate adjustment
-        .min_factor = 900,        // 0.9x precision focus
-        .sensor_dpi = 6400        // Ultra-high DPI laser
-    },
-    {
-        .name = "high_sens_trackball",
-        .sensitivity = 1400,      // 1.4x (800 DPI adjustment)
-        .max_factor = 2600,       // 2.6x strong acceleration
-        .curve_type = 1,          // Mild (easier to control)
-        .y_boost = 1200,          // 1.2x Y-axis enhancement
-        .speed_threshold = 500,   // Quick response
-        .speed_max = 2500,        // Moderate adjustment
-        .min_factor = 880,        // 0.88x precision focus
-        .sensor_dpi = 800         // High precision trackball
-    },
-    
     // Trackpad/Touchpad presets
-    {
-        .name = "office_trackpad",
-        .sensitivity = 1200,      // 1.2x (trackpad adjustment)
-        .max_factor = 1800,       // 1.8x conservative acceleration
-        .curve_type = 0,          // Linear (natural feel)
-        .y_boost = 1000,          // 1.0x Y-axis standard
-        .speed_threshold = 600,   // Moderate response
-        .speed_max = 2200,        // Conservative max speed
-        .min_factor = 900,        // 0.9x precision focus
-        .sensor_dpi = 1000        // Standard trackpad
-    },
-    {
-        .name = "gaming_trackpad",
-        .sensitivity = 1100,      // 1.1x (gaming adjustment)
-        .max_factor = 2200,       // 2.2x moderate acceleration
-        .curve_type = 1,          // Mild (easier to control)
-        .y_boost = 1050,          // 1.05x Y-axis slight enhancement
-        .speed_threshold = 500,   // Quick response
-        .speed_max = 2400,        // Moderate max speed
-        .min_factor = 920,        // 0.92x precision control
-        .sensor_dpi = 1200        // High resolution trackpad
-    },
-    {
-        .name = "high_sens_trackpad",
-        .sensitivity = 1300,      // 1.3x (high sensitivity adjustment)
-        .max_factor = 2400,       // 2.4x strong acceleration
-        .curve_type = 1,          // Mild (easier to control)
-        .y_boost = 1100,          // 1.1x Y-axis enhancement
-        .speed_threshold = 400,   // Immediate response
-        .speed_max = 2300,        // Moderate adjustment
-        .min_factor = 850,        // 0.85x precision focus
-        .sensor_dpi = 1200        // High resolution trackpad
-    }
+    ACCEL_PRESET_ENTRY("office_trackpad", ACCEL_PRESET_OFFICE_TRACKPAD),
+    ACCEL_PRESET_ENTRY("gaming_trackpad", ACCEL_PRESET_GAMING_TRACKPAD),
+    ACCEL_PRESET_ENTRY("high_sens_trackpad", ACCEL_PRESET_HIGH_SENS_TRACKPAD),
 };
 
 #define NUM_PRESETS (sizeof(presets) / sizeof(presets[0]))
@@ -209,12 +104,12 @@ int accel_config_apply_preset(struct accel_config *cfg, const char *preset_name)
         cfg->cfg.level2.min_factor = preset->min_factor;
         // For presets, use default acceleration_exponent (2 = mild exponential)
         // Advanced curve customization is only available in custom configuration
-        cfg->cfg.level2.acceleration_exponent = 2;
+        cfg->cfg.level2.acceleration_exponent = ACCEL_DEFAULT_EXPONENT;
     }
     
     // Common settings (encoded format)
     cfg->y_boost_scaled = accel_encode_y_boost(preset->y_boost);
-    cfg->sensor_dpi_class = accel_encode_sensor_dpi(preset->sensor_dpi);
+    accel_set_sensor_dpi(cfg, preset->sensor_dpi);
     
     LOG_DBG("Applied preset values to config");
     
@@ -13,6 +13,73 @@
 extern "C" {
 #endif
 
+/**
+ * Preset values, in this order: sensitivity, max factor, curve type,
+ * Y boost, speed threshold, speed max, min factor (the last three Level 2
+ * only), sensor DPI. Single source for the runtime preset table and the
+ * compile-time configuration (CONFIG_INPUT_PROCESSOR_ACCEL_CONST_CONFIG).
+ */
+//                                        sens   max curve ybst thr   smax  min   dpi
+#define ACCEL_PRESET_OFFICE_OPTICAL       1000, 2200, 1, 1080,  700, 2600,  980,  800
+#define ACCEL_PRESET_OFFICE_LASER         1000, 1500, 0, 1000, 1000, 2000, 1000, 1600
+#define ACCEL_PRESET_OFFICE_TRACKBALL     1500, 2000, 1, 1100,  800, 2400,  950,  400
+#define ACCEL_PRESET_GAMING_OPTICAL       1000, 2500, 2, 1120,  550, 2800,  950, 1200
+#define ACCEL_PRESET_GAMING_LASER          600, 2500, 2, 1120,  550, 2800,  950, 3200
+#define ACCEL_PRESET_GAMING_TRACKBALL     1200, 2300, 2, 1150,  600, 2700,  940,  800
+#define ACCEL_PRESET_HIGH_SENS_OPTICAL    1100, 2800, 1, 1150,  450, 2400,  900, 1600
+#define ACCEL_PRESET_HIGH_SENS_LASER       500, 2800, 1, 1150,  450, 2400,  900, 6400
+#define ACCEL_PRESET_HIGH_SENS_TRACKBALL  1400, 2600, 1, 1200,  500, 2500,  880,  800
+#define ACCEL_PRESET_OFFICE_TRACKPAD      1200, 1800, 0, 1000,  600, 2200,  900, 1000
+#define ACCEL_PRESET_GAMING_TRACKPAD      1100, 2200, 1, 1050,  500, 2400,  920, 1200
+#define ACCEL_PRESET_HIGH_SENS_TRACKPAD   1300, 2400, 1, 1100,  400, 2300,  850, 1200
+
+// Field access (variadic so a list macro can be passed through other macros):
+// ACCEL_PRESET_SENSITIVITY(ACCEL_PRESET_OFFICE_OPTICAL) == 1000
+#define Z_ACCEL_PRESET_CALL(f, ...)             f(__VA_ARGS__)
+#define Z_ACCEL_PRESET_SENS(s, m, c, y, t, x, n, d)   s
+#define Z_ACCEL_PRESET_MAX(s, m, c, y, t, x, n, d)    m
+#define Z_ACCEL_PRESET_CURVE(s, m, c, y, t, x, n, d)  c
+#define Z_ACCEL_PRESET_YBOOST(s, m, c, y, t, x, n, d) y
+#define Z_ACCEL_PRESET_THRESH(s, m, c, y, t, x, n, d) t
+#define Z_ACCEL_PRESET_SMAX(s, m, c, y, t, x, n, d)   x
+#define Z_ACCEL_PRESET_MIN(s, m, c, y, t, x, n, d)    n
+#define Z_ACCEL_PRESET_DPI(s, m, c, y, t, x, n, d)    d
+#define ACCEL_PRESET_SENSITIVITY(...)   Z_ACCEL_PRESET_CALL(Z_ACCEL_PRESET_SENS, __VA_ARGS__)
+#define ACCEL_PRESET_MAX_FACTOR(...)    Z_ACCEL_PRESET_CALL(Z_ACCEL_PRESET_MAX, __VA_ARGS__)
+#define ACCEL_PRESET_CURVE_TYPE(...)    Z_ACCEL_PRESET_CALL(Z_ACCEL_PRESET_CURVE, __VA_ARGS__)
+#define ACCEL_PRESET_Y_BOOST(...)       Z_ACCEL_PRESET_CALL(Z_ACCEL_PRESET_YBOOST, __VA_ARGS__)
+#define ACCEL_PRESET_SPEED_THRESHOLD(...) Z_ACCEL_PRESET_CALL(Z_ACCEL_PRESET_THRESH, __VA_ARGS__)
+#define ACCEL_PRESET_SPEED_MAX(...)     Z_ACCEL_PRESET_CALL(Z_ACCEL_PRESET_SMAX, __VA_ARGS__)
+#define ACCEL_PRESET_MIN_FACTOR(...)    Z_ACCEL_PRESET_CALL(Z_ACCEL_PRESET_MIN, __VA_ARGS__)
+#define ACCEL_PRESET_SENSOR_DPI(...)    Z_ACCEL_PRESET_CALL(Z_ACCEL_PRESET_DPI, __VA_ARGS__)
+
+// Preset selected in Kconfig (undefined for custom / no preset)
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_PRESET_OFFICE_OPTICAL)
+#define ACCEL_KCONFIG_PRESET ACCEL_PRESET_OFFICE_OPTICAL
+#elif defined(CONFIG_INPUT_PROCESSOR_ACCEL_PRESET_OFFICE_LASER)
+#define ACCEL_KCONFIG_PRESET ACCEL_PRESET_OFFICE_LASER
+#elif defined(CONFIG_INPUT_PROCESSOR_ACCEL_PRESET_OFFICE_TRACKBALL)
+#define ACCEL_KCONFIG_PRESET ACCEL_PRESET_OFFICE_TRACKBALL
+#elif defined(CONFIG_INPUT_PROCESSOR_ACCEL_PRESET_GAMING_OPTICAL)
+#define ACCEL_KCONFIG_PRESET ACCEL_PRESET_GAMING_OPTICAL
+#elif defined(CONFIG_INPUT_PROCESSOR_ACCEL_PRESET_GAMING_LASER)
+#define ACCEL_KCONFIG_PRESET ACCEL_PRESET_GAMING_LASER
+#elif defined(CONFIG_INPUT_PROCESSOR_ACCEL_PRESET_GAMING_TRACKBALL)
+#define ACCEL_KCONFIG_PRESET ACCEL_PRESET_GAMING_TRACKBALL
+#elif defined(CONFIG_INPUT_PROCESSOR_ACCEL_PRESET_HIGH_SENS_OPTICAL)
+#define ACCEL_KCONFIG_PRESET ACCEL_PRESET_HIGH_SENS_OPTICAL
+#elif defined(CONFIG_INPUT_PROCESSOR_ACCEL_PRESET_HIGH_SENS_LASER)
+#define ACCEL_KCONFIG_PRESET ACCEL_PRESET_HIGH_SENS_LASER
+#elif defined(CONFIG_INPUT_PROCESSOR_ACCEL_PRESET_HIGH_SENS_TRACKBALL)
+#define ACCEL_KCONFIG_PRESET ACCEL_PRESET_HIGH_SENS_TRACKBALL
+#elif defined(CONFIG_INPUT_PROCESSOR_ACCEL_PRESET_OFFICE_TRACKPAD)
+#define ACCEL_KCONFIG_PRESET ACCEL_PRESET_OFFICE_TRACKPAD
+#elif defined(CONFIG_INPUT_PROCESSOR_ACCEL_PRESET_GAMING_TRACKPAD)
+#define ACCEL_KCONFIG_PRESET ACCEL_PRESET_GAMING_TRACKPAD
+#elif defined(CONFIG_INPUT_PROCESSOR_ACCEL_PRESET_HIGH_SENS_TRACKPAD)
+#define ACCEL_KCONFIG_PRESET ACCEL_PRESET_HIGH_SENS_TRACKPAD
+#endif
+
 /**
  * @brief Apply preset configuration
  * @param cfg Configuration structure to modify
@@ -23,16 +23,16 @@ int accel_validate_config(const struct accel_config *cfg) {
         return ACCEL_ERR_INVALID_ARG;
     }
 
-    // Validate DPI class with enhanced bounds checking
-    if (cfg->sensor_dpi_class > 7) { // Allow up to 7 (8 total entries in table)
-        LOG_ERR("Invalid sensor DPI class: %u (must be 0-7)", cfg->sensor_dpi_class);
-        return ACCEL_ERR_INVALID_ARG;
+    uint16_t sensor_dpi = cfg->sensor_dpi;
+    if (sensor_dpi < SENSOR_DPI_MIN || sensor_dpi > MAX_SENSOR_DPI) {
+        LOG_ERR("Sensor DPI %u out of reasonable range (%u-%u)", sensor_dpi, SENSOR_DPI_MIN, MAX_SENSOR_DPI);
+        return ACCEL_ERR_OUT_OF_RANGE;
     }
     
-    uint16_t sensor_dpi = accel_decode_sensor_dpi(cfg->sensor_dpi_class);
-    if (sensor_dpi < 400 || sensor_dpi > MAX_SENSOR_DPI) {
-        LOG_ERR("Sensor DPI %u out of reasonable range (400-%u)", sensor_dpi, MAX_SENSOR_DPI);
-        return ACCEL_ERR_OUT_OF_RANGE;
+    // Cached adjustment must match the sensitivity and DPI it was computed from
+    if (cfg->dpi_sensitivity != calculate_dpi_adjusted_sensitivity(cfg)) {
+        LOG_ERR("DPI-adjusted sensitivity not updated for %u DPI", sensor_dpi);
+        return ACCEL_ERR_INVALID_ARG;
     }
     
     // Prevent extreme values that could cause overflow
@@ -86,7 +86,8 @@ int accel_validate_config(const struct accel_config *cfg) {
             return ACCEL_ERR_INVALID_ARG;
         }
         
-        // Validate speed ranges
+        // Validate speed ranges (the 16-bit fields can't exceed the wide-range limit)
+#if MAX_REASONABLE_SPEED < UINT16_MAX
         if (cfg->cfg.level2.speed_threshold > MAX_REASONABLE_SPEED) {
             LOG_ERR("Speed threshold %u exceeds reasonable limit %u", 
                     cfg->cfg.level2.speed_threshold, MAX_REASONABLE_SPEED);
@@ -97,6 +98,7 @@ int accel_validate_config(const struct accel_config *cfg) {
                     cfg->cfg.level2.speed_max, MAX_REASONABLE_SPEED);
             return ACCEL_ERR_OUT_OF_RANGE;
         }
+#endif
         
         // Prevent invalid factor relationship
         if (cfg->cfg.level2.min_factor > cfg->cfg.level2.max_factor) {
@@ -118,6 +120,28 @@ int accel_validate_config(const struct accel_config *cfg) {
         }
     }
     
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_FAST_PATH)
+    // The fast path has no per-event guards: accept only the Kconfig/DT
+    // ranges, the domain tools/host/domaincheck verifies
+    if (sensitivity < SENSITIVITY_MIN || sensitivity > SENSITIVITY_MAX ||
+        max_factor < MAX_FACTOR_MIN || max_factor > MAX_FACTOR_MAX) {
+        LOG_ERR("Fast path: sensitivity %u / max factor %u outside %u-%u / %u-%u",
+                sensitivity, max_factor, SENSITIVITY_MIN, SENSITIVITY_MAX,
+                MAX_FACTOR_MIN, MAX_FACTOR_MAX);
+        return ACCEL_ERR_OUT_OF_RANGE;
+    }
+    if (cfg->level == 2 &&
+        (cfg->cfg.level2.speed_threshold < SPEED_THRESHOLD_MIN ||
+         cfg->cfg.level2.speed_threshold > SPEED_THRESHOLD_MAX ||
+         cfg->cfg.level2.speed_max < SPEED_MAX_MIN || cfg->cfg.level2.speed_max > SPEED_MAX_MAX ||
+         cfg->cfg.level2.min_factor < MIN_FACTOR_MIN || cfg->cfg.level2.min_factor > MIN_FACTOR_MAX)) {
+        LOG_ERR("Fast path: speed %u-%u / min factor %u outside the Kconfig ranges",
+                cfg->cfg.level2.speed_threshold, cfg->cfg.level2.speed_max,
+                cfg->cfg.level2.min_factor);
+        return ACCEL_ERR_OUT_OF_RANGE;
+    }
+#endif
+    
     // Logical consistency checks
     if (max_factor <= sensitivity) {
         LOG_WRN("Max factor (%u) should typically be greater than sensitivity (%u)", 
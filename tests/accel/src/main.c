@@ -0,0 +1,528 @@
+// main.c - ztest suite for the acceleration processor on native_sim
+// Runs the devicetree instances through the ZMK input processor API with a
+// test-controlled clock: configuration from devicetree and presets, event
+// results against the calculation functions, code filtering, two threads
+// using the processor at once and one instance driven from a thread and an
+// interrupt
+//
+// SPDX-License-Identifier: MIT
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/input/input.h>
+#include <zephyr/ztest.h>
+#include <stdlib.h>
+#include <string.h>
+#include <drivers/input_processor.h>
+#include <drivers/input_processor_accel.h>
+#include "../../../src/config/accel_config.h"
+#include "../../../src/config/accel_config_adapter.h"
+#include "../../../src/presets/accel_presets.h"
+
+#define ACCEL_NODE    DT_NODELABEL(pointer_accel)
+#define DEFAULTS_NODE DT_NODELABEL(accel_defaults)
+
+// Events per thread in the concurrency test
+#define TEST_THREAD_EVENTS     2000
+#define TEST_THREAD_STACK_SIZE 2048
+
+// Timer interrupts that send events in the same-instance test
+#define TEST_ISR_EVENTS    200
+#define TEST_ISR_PERIOD_US 500
+
+static const struct device *const accel_dev = DEVICE_DT_GET(ACCEL_NODE);
+static const struct device *const defaults_dev = DEVICE_DT_GET(DEFAULTS_NODE);
+
+// =============================================================================
+// TEST CLOCK
+// =============================================================================
+
+// Only moves when a test advances it; never 0 ms (the speed state's "no event yet")
+static uint32_t test_now_us;
+
+static uint32_t test_uptime_ms(void *user_data) {
+    ARG_UNUSED(user_data);
+    return test_now_us / 1000;
+}
+
+static uint32_t test_uptime_us(void *user_data) {
+    ARG_UNUSED(user_data);
+    return test_now_us;
+}
+
+static const struct accel_clock test_clock = {
+    .uptime_ms = test_uptime_ms,
+    .uptime_us = test_uptime_us,
+};
+
+// =============================================================================
+// HELPERS
+// =============================================================================
+
+struct test_params {
+    const char *name;
+    uint16_t sensitivity;
+    uint16_t max_factor;
+    uint8_t curve_type;            // Level 1
+    uint16_t y_boost;
+    uint16_t speed_threshold;      // Level 2
+    uint16_t speed_max;            // Level 2
+    uint16_t min_factor;           // Level 2
+    uint8_t exponent;              // Level 2
+    uint16_t sensor_dpi;
+};
+
+#define TEST_DT_PARAMS(node)                                                                     \
+    {                                                                                           \
+        .name = DT_NODE_FULL_NAME(node),                                                        \
+        .sensitivity = DT_PROP(node, sensitivity),                                              \
+        .max_factor = DT_PROP(node, max_factor),                                                \
+        .curve_type = DT_PROP(node, curve_type),                                                \
+        .y_boost = DT_PROP(node, y_boost),                                                      \
+        .speed_threshold = DT_PROP(node, speed_threshold),                                      \
+        .speed_max = DT_PROP(node, speed_max),                                                  \
+        .min_factor = DT_PROP(node, min_factor),                                                \
+        .exponent = DT_PROP(node, acceleration_exponent),                                       \
+        .sensor_dpi = DT_PROP(node, sensor_dpi),                                                \
+    }
+
+// Presets keep the default exponent (accel_config_apply_preset())
+#define TEST_PRESET_PARAMS(preset_name, ...)                                                     \
+    {                                                                                           \
+        .name = preset_name,                                                                    \
+        .sensitivity = ACCEL_PRESET_SENSITIVITY(__VA_ARGS__),                                   \
+        .max_factor = ACCEL_PRESET_MAX_FACTOR(__VA_ARGS__),                                     \
+        .curve_type = ACCEL_PRESET_CURVE_TYPE(__VA_ARGS__),                                     \
+        .y_boost = ACCEL_PRESET_Y_BOOST(__VA_ARGS__),                                           \
+        .speed_threshold = ACCEL_PRESET_SPEED_THRESHOLD(__VA_ARGS__),                           \
+        .speed_max = ACCEL_PRESET_SPEED_MAX(__VA_ARGS__),                                       \
+        .min_factor = ACCEL_PRESET_MIN_FACTOR(__VA_ARGS__),                                     \
+        .exponent = ACCEL_DEFAULT_EXPONENT,                                                     \
+        .sensor_dpi = ACCEL_PRESET_SENSOR_DPI(__VA_ARGS__),                                     \
+    }
+
+static const struct test_params test_presets[] = {
+    TEST_PRESET_PARAMS("office_optical", ACCEL_PRESET_OFFICE_OPTICAL),
+    TEST_PRESET_PARAMS("office_laser", ACCEL_PRESET_OFFICE_LASER),
+    TEST_PRESET_PARAMS("office_trackball", ACCEL_PRESET_OFFICE_TRACKBALL),
+    TEST_PRESET_PARAMS("gaming_optical", ACCEL_PRESET_GAMING_OPTICAL),
+    TEST_PRESET_PARAMS("gaming_laser", ACCEL_PRESET_GAMING_LASER),
+    TEST_PRESET_PARAMS("gaming_trackball", ACCEL_PRESET_GAMING_TRACKBALL),
+    TEST_PRESET_PARAMS("high_sens_optical", ACCEL_PRESET_HIGH_SENS_OPTICAL),
+    TEST_PRESET_PARAMS("high_sens_laser", ACCEL_PRESET_HIGH_SENS_LASER),
+    TEST_PRESET_PARAMS("high_sens_trackball", ACCEL_PRESET_HIGH_SENS_TRACKBALL),
+    TEST_PRESET_PARAMS("office_trackpad", ACCEL_PRESET_OFFICE_TRACKPAD),
+    TEST_PRESET_PARAMS("gaming_trackpad", ACCEL_PRESET_GAMING_TRACKPAD),
+    TEST_PRESET_PARAMS("high_sens_trackpad", ACCEL_PRESET_HIGH_SENS_TRACKPAD),
+};
+
+static void test_check_config(const struct accel_config *cfg, const struct test_params *p) {
+    zassert_equal(cfg->level, CONFIG_INPUT_PROCESSOR_ACCEL_LEVEL, "%s: level", p->name);
+    if (cfg->level == 1) {
+        zassert_equal(cfg->cfg.level1.sensitivity, p->sensitivity, "%s: sensitivity", p->name);
+        zassert_equal(cfg->cfg.level1.max_factor, p->max_factor, "%s: max-factor", p->name);
+        zassert_equal(cfg->cfg.level1.curve_type, p->curve_type, "%s: curve-type", p->name);
+    } else {
+        zassert_equal(cfg->cfg.level2.sensitivity, p->sensitivity, "%s: sensitivity", p->name);
+        zassert_equal(cfg->cfg.level2.max_factor, p->max_factor, "%s: max-factor", p->name);
+        zassert_equal(cfg->cfg.level2.speed_threshold, p->speed_threshold,
+                      "%s: speed-threshold", p->name);
+        zassert_equal(cfg->cfg.level2.speed_max, p->speed_max, "%s: speed-max", p->name);
+        zassert_equal(cfg->cfg.level2.min_factor, p->min_factor, "%s: min-factor", p->name);
+        zassert_equal(cfg->cfg.level2.acceleration_exponent, p->exponent,
+                      "%s: acceleration-exponent", p->name);
+    }
+    zassert_equal(accel_decode_y_boost(cfg->y_boost_scaled), p->y_boost, "%s: y-boost", p->name);
+    zassert_equal(cfg->sensor_dpi, p->sensor_dpi, "%s: sensor-dpi", p->name);
+    zassert_equal(accel_get_dpi_sensitivity(cfg), calculate_dpi_adjusted_sensitivity(cfg),
+                  "%s: cached DPI-adjusted sensitivity is stale", p->name);
+    zassert_ok(accel_validate_config(cfg), "%s: config does not validate", p->name);
+}
+
+// One event through the driver API, as ZMK's input listener hands it over
+static int test_handle(const struct device *dev, uint8_t type, uint16_t code, int32_t *value,
+                       bool sync) {
+    struct input_event event = {
+        .type = type,
+        .code = code,
+        .value = *value,
+        .sync = sync,
+    };
+    int ret = zmk_input_processor_handle_event(dev, &event, 0, 0, NULL);
+
+    *value = event.value;
+    return ret;
+}
+
+static int32_t test_event(const struct device *dev, uint8_t type, uint16_t code, int32_t value,
+                          bool sync) {
+    zassert_equal(test_handle(dev, type, code, &value, sync), ZMK_INPUT_PROC_CONTINUE,
+                  "event not passed on");
+    return value;
+}
+
+/**
+ * Expected output of the default stage chain for a non-zero delta: the
+ * level calculation on the clamped input, the emergency brake, then the
+ * minimum movement. shadow tracks the Level 2 speed state.
+ */
+static int32_t test_expected(const struct accel_config *cfg, struct accel_data *shadow,
+                             uint16_t code, int32_t value) {
+    int32_t input = accel_clamp_input_value(value);
+    int32_t out = (cfg->level == 1) ? accel_simple_calculate(cfg, input, code)
+                                    : accel_standard_calculate(cfg, shadow, input, code);
+
+    if (abs(out) > EMERGENCY_BRAKE_THRESHOLD) {
+        out = (out > 0) ? EMERGENCY_BRAKE_LIMIT : -EMERGENCY_BRAKE_LIMIT;
+    }
+    if (out == 0) {
+        out = (input > 0) ? 1 : -1;
+    }
+    return out;
+}
+
+// Deterministic non-zero deltas in -60..60
+static int32_t test_delta(uint32_t i) {
+    int32_t value = (int32_t)((i * 37U) % 121U) - 60;
+    return value ? value : 1;
+}
+
+static void test_reset(const struct device *dev) {
+    memset(dev->data, 0, sizeof(struct accel_data));
+}
+
+static void *accel_suite_setup(void) {
+    zassert_ok(accel_set_clock(&test_clock));
+    return NULL;
+}
+
+static void accel_before(void *fixture) {
+    ARG_UNUSED(fixture);
+    test_now_us = 1000000;
+    test_reset(accel_dev);
+    test_reset(defaults_dev);
+}
+
+ZTEST_SUITE(accel, NULL, accel_suite_setup, accel_before, NULL, NULL);
+
+// =============================================================================
+// CONFIGURATION
+// =============================================================================
+
+ZTEST(accel, test_devices_ready) {
+    zassert_true(device_is_ready(accel_dev));
+    zassert_true(device_is_ready(defaults_dev));
+}
+
+ZTEST(accel, test_dt_properties) {
+#if defined(ACCEL_KCONFIG_PRESET)
+    ztest_test_skip(); // The Kconfig preset replaces the properties
+#else
+    const struct test_params custom = TEST_DT_PARAMS(ACCEL_NODE);
+    const struct test_params defaults = TEST_DT_PARAMS(DEFAULTS_NODE);
+
+    // The overlay moves every pointer_accel property off its default
+    zassert_not_equal(custom.sensitivity, defaults.sensitivity);
+    zassert_not_equal(custom.sensor_dpi, defaults.sensor_dpi);
+    test_check_config(accel_dev->config, &custom);
+    test_check_config(defaults_dev->config, &defaults);
+#endif
+}
+
+ZTEST(accel, test_kconfig_preset) {
+#if defined(ACCEL_KCONFIG_PRESET)
+    const struct test_params preset = TEST_PRESET_PARAMS("kconfig preset", ACCEL_KCONFIG_PRESET);
+
+    test_check_config(accel_dev->config, &preset);
+    test_check_config(defaults_dev->config, &preset);
+#else
+    ztest_test_skip();
+#endif
+}
+
+ZTEST(accel, test_every_preset) {
+    // Presets are applied to the runtime configuration
+    Z_TEST_SKIP_IFDEF(CONFIG_INPUT_PROCESSOR_ACCEL_CONST_CONFIG);
+
+    struct accel_config *cfg = (struct accel_config *)accel_dev->config;
+    const struct accel_config saved = *cfg;
+
+    for (size_t i = 0; i < ARRAY_SIZE(test_presets); i++) {
+        const struct test_params *p = &test_presets[i];
+        struct accel_data shadow;
+
+        zassert_ok(accel_config_apply_preset(cfg, p->name), "%s not applied", p->name);
+        test_check_config(cfg, p);
+
+        // The preset is live for the next events
+        test_reset(accel_dev);
+        memset(&shadow, 0, sizeof(shadow));
+        for (uint32_t n = 0; n < 8; n++) {
+            test_now_us += 1000;
+            int32_t x = test_delta(n);
+            int32_t y = test_delta(n + 50);
+            int32_t want_x = test_expected(cfg, &shadow, INPUT_REL_X, x);
+            int32_t want_y = test_expected(cfg, &shadow, INPUT_REL_Y, y);
+
+            zassert_equal(test_event(accel_dev, INPUT_EV_REL, INPUT_REL_X, x, false), want_x,
+                          "%s: X %d", p->name, x);
+            zassert_equal(test_event(accel_dev, INPUT_EV_REL, INPUT_REL_Y, y, true), want_y,
+                          "%s: Y %d", p->name, y);
+        }
+        *cfg = saved;
+    }
+}
+
+// =============================================================================
+// EVENTS
+// =============================================================================
+
+ZTEST(accel, test_handle_event) {
+    static const int32_t deltas[] = {1, -1, 2, 5, -17, 40, 100, -250, 3};
+    const struct accel_config *cfg = accel_dev->config;
+    struct accel_data shadow;
+
+    memset(&shadow, 0, sizeof(shadow));
+    for (size_t i = 0; i < ARRAY_SIZE(deltas); i++) {
+        test_now_us += 1000;
+        int32_t x = deltas[i];
+        int32_t y = -deltas[ARRAY_SIZE(deltas) - 1 - i];
+        int32_t want_x = test_expected(cfg, &shadow, INPUT_REL_X, x);
+        int32_t want_y = test_expected(cfg, &shadow, INPUT_REL_Y, y);
+
+        zassert_equal(test_event(accel_dev, INPUT_EV_REL, INPUT_REL_X, x, false), want_x,
+                      "X %d", x);
+        zassert_equal(test_event(accel_dev, INPUT_EV_REL, INPUT_REL_Y, y, true), want_y,
+                      "Y %d", y);
+    }
+
+    // Wheel axes go through the same calculation
+    test_now_us += 1000;
+    zassert_equal(test_event(accel_dev, INPUT_EV_REL, INPUT_REL_WHEEL, 3, true),
+                  test_expected(cfg, &shadow, INPUT_REL_WHEEL, 3));
+    test_now_us += 1000;
+    zassert_equal(test_event(accel_dev, INPUT_EV_REL, INPUT_REL_HWHEEL, -2, true),
+                  test_expected(cfg, &shadow, INPUT_REL_HWHEEL, -2));
+
+    // No movement stays no movement
+    zassert_equal(test_event(accel_dev, INPUT_EV_REL, INPUT_REL_X, 0, true), 0);
+}
+
+ZTEST(accel, test_code_filtering) {
+    struct accel_data before;
+
+    test_now_us += 1000;
+    test_event(accel_dev, INPUT_EV_REL, INPUT_REL_X, 10, true);
+    memcpy(&before, accel_dev->data, sizeof(before));
+
+    // Other event types and unsupported codes pass unchanged and leave the state alone
+    test_now_us += 1000;
+    zassert_equal(test_event(accel_dev, INPUT_EV_KEY, INPUT_REL_X, 50, true), 50);
+    zassert_equal(test_event(accel_dev, INPUT_EV_ABS, INPUT_ABS_X, 50, true), 50);
+    zassert_equal(test_event(accel_dev, INPUT_EV_REL, INPUT_REL_MISC, 50, true), 50);
+    zassert_equal(test_event(accel_dev, INPUT_EV_REL, INPUT_REL_Z, -50, true), -50);
+    zassert_mem_equal(&before, accel_dev->data, sizeof(before), "filtered event changed state");
+}
+
+// =============================================================================
+// CLOCK
+// =============================================================================
+
+// Output of the last of 10 reports of (20, 0) sent interval_us apart
+static int32_t test_steady(uint32_t interval_us) {
+    int32_t out = 0;
+
+    test_reset(accel_dev);
+    for (int i = 0; i < 10; i++) {
+        test_now_us += interval_us;
+        out = test_event(accel_dev, INPUT_EV_REL, INPUT_REL_X, 20, true);
+    }
+    return out;
+}
+
+ZTEST(accel, test_clock_drives_speed) {
+    const struct accel_data *data = accel_dev->data;
+
+    int32_t fast = test_steady(1000);     // 20000 counts/s
+    int32_t slow = test_steady(500000);   // 40 counts/s
+
+    if (IS_ENABLED(CONFIG_INPUT_PROCESSOR_ACCEL_LEVEL_STANDARD)) {
+        zassert_equal(data->last_time_ms, test_now_us / 1000, "speed state not on the test clock");
+        zassert_true(fast > slow, "fast %d, slow %d", fast, slow);
+    } else {
+        // Level 1 gain depends on the delta only
+        zassert_equal(fast, slow);
+    }
+}
+
+// =============================================================================
+// CONCURRENCY
+// =============================================================================
+
+K_THREAD_STACK_DEFINE(test_stack_a, TEST_THREAD_STACK_SIZE);
+K_THREAD_STACK_DEFINE(test_stack_b, TEST_THREAD_STACK_SIZE);
+static struct k_thread test_thread_a;
+static struct k_thread test_thread_b;
+
+static int32_t test_outputs_b[TEST_THREAD_EVENTS];
+static atomic_t test_bad_a;
+
+static inline uint16_t test_code(uint32_t i) {
+    return (i & 1) ? INPUT_REL_Y : INPUT_REL_X;
+}
+
+// Result of an event whose expected value depends on interleaving: passed on,
+// sign kept and within the brake limit
+static bool test_output_ok(int ret, int32_t in, int32_t out) {
+    return ret == ZMK_INPUT_PROC_CONTINUE && out != 0 && (out > 0) == (in > 0) &&
+           abs(out) <= EMERGENCY_BRAKE_THRESHOLD;
+}
+
+// pointer_accel: sign kept and bounded output while thread B changes its sensitivity
+// (no assertions off the test thread; failures are counted)
+static void test_thread_a_fn(void *p1, void *p2, void *p3) {
+    ARG_UNUSED(p1);
+    ARG_UNUSED(p2);
+    ARG_UNUSED(p3);
+
+    for (uint32_t i = 0; i < TEST_THREAD_EVENTS; i++) {
+        int32_t in = test_delta(i);
+        int32_t out = in;
+        int ret = test_handle(accel_dev, INPUT_EV_REL, test_code(i), &out, i & 1);
+
+        if (!test_output_ok(ret, in, out)) {
+            atomic_inc(&test_bad_a);
+        }
+        if ((i & 15) == 0) {
+            k_yield();
+        }
+    }
+}
+
+// accel_defaults: record outputs for a sequential replay
+static void test_thread_b_fn(void *p1, void *p2, void *p3) {
+    ARG_UNUSED(p1);
+    ARG_UNUSED(p2);
+    ARG_UNUSED(p3);
+#if !defined(CONFIG_INPUT_PROCESSOR_ACCEL_CONST_CONFIG)
+    struct accel_config *cfg_a = (struct accel_config *)accel_dev->config;
+#endif
+
+    for (uint32_t i = 0; i < TEST_THREAD_EVENTS; i++) {
+        test_outputs_b[i] = test_delta(i + 7);
+        test_handle(defaults_dev, INPUT_EV_REL, test_code(i), &test_outputs_b[i], i & 1);
+#if !defined(CONFIG_INPUT_PROCESSOR_ACCEL_CONST_CONFIG)
+        if ((i & 7) == 0) {
+            accel_set_sensitivity(cfg_a, (i & 8) ? 800 : 1600);
+        }
+#endif
+        if ((i & 15) == 8) {
+            k_yield();
+        }
+    }
+}
+
+ZTEST(accel, test_two_threads) {
+    const struct accel_config *cfg_a = accel_dev->config;
+    const struct accel_config saved = *cfg_a;
+
+    // The clock stays put, so accel_defaults' results depend on its own events only
+    atomic_clear(&test_bad_a);
+    k_thread_create(&test_thread_a, test_stack_a, K_THREAD_STACK_SIZEOF(test_stack_a),
+                    test_thread_a_fn, NULL, NULL, NULL, K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+    k_thread_create(&test_thread_b, test_stack_b, K_THREAD_STACK_SIZEOF(test_stack_b),
+                    test_thread_b_fn, NULL, NULL, NULL, K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+    zassert_ok(k_thread_join(&test_thread_a, K_FOREVER));
+    zassert_ok(k_thread_join(&test_thread_b, K_FOREVER));
+
+    zassert_equal(atomic_get(&test_bad_a), 0, "pointer_accel outputs out of bounds");
+    zassert_ok(accel_validate_config(cfg_a));
+    zassert_equal(accel_get_dpi_sensitivity(cfg_a), calculate_dpi_adjusted_sensitivity(cfg_a),
+                  "cached DPI-adjusted sensitivity is stale");
+
+    // Same events on one thread: identical results
+    test_reset(defaults_dev);
+    for (uint32_t i = 0; i < TEST_THREAD_EVENTS; i++) {
+        zassert_equal(test_event(defaults_dev, INPUT_EV_REL, test_code(i), test_delta(i + 7),
+                                 i & 1),
+                      test_outputs_b[i], "event %u differs from the sequential run", i);
+    }
+
+#if !defined(CONFIG_INPUT_PROCESSOR_ACCEL_CONST_CONFIG)
+    *(struct accel_config *)cfg_a = saved;
+#else
+    ARG_UNUSED(saved);
+#endif
+}
+
+// =============================================================================
+// SAME INSTANCE FROM TWO CONTEXTS
+// =============================================================================
+
+static struct k_timer test_timer;
+static atomic_t test_isr_events;
+static atomic_t test_bad_isr;
+static atomic_t test_bad_thread;
+
+// One event per check: bounds at Level 2 (the shared speed state depends on
+// interleaving), the exact stateless result at Level 1
+static void test_same_instance_event(uint32_t i, int32_t in, atomic_t *bad) {
+    const struct accel_config *cfg = accel_dev->config;
+    int32_t out = in;
+    int ret = test_handle(accel_dev, INPUT_EV_REL, test_code(i), &out, true);
+
+    if (!test_output_ok(ret, in, out) ||
+        (cfg->level == 1 && out != test_expected(cfg, NULL, test_code(i), in))) {
+        atomic_inc(bad);
+    }
+}
+
+// Interrupt context, like a sensor driver reporting from its ISR
+static void test_timer_fn(struct k_timer *timer) {
+    uint32_t i = (uint32_t)atomic_inc(&test_isr_events);
+
+    if (i >= TEST_ISR_EVENTS) {
+        k_timer_stop(timer);
+        return;
+    }
+    test_same_instance_event(i, test_delta(i + 13), &test_bad_isr);
+}
+
+ZTEST(accel, test_same_instance_thread_and_isr) {
+    const struct accel_config *cfg = accel_dev->config;
+    const struct accel_data *data = accel_dev->data;
+    struct accel_data shadow;
+    uint32_t i = 0;
+
+    atomic_clear(&test_isr_events);
+    atomic_clear(&test_bad_isr);
+    atomic_clear(&test_bad_thread);
+    k_timer_init(&test_timer, test_timer_fn, NULL);
+    k_timer_start(&test_timer, K_USEC(TEST_ISR_PERIOD_US), K_USEC(TEST_ISR_PERIOD_US));
+
+    // The thread sends to pointer_accel too; its sleeps let the timer interrupt in
+    while (atomic_get(&test_isr_events) < TEST_ISR_EVENTS) {
+        test_same_instance_event(i, test_delta(i), &test_bad_thread);
+        if ((++i & 3) == 0) {
+            k_sleep(K_USEC(100));
+        }
+    }
+    k_timer_stop(&test_timer);
+
+    zassert_equal(atomic_get(&test_bad_thread), 0, "thread outputs wrong");
+    zassert_equal(atomic_get(&test_bad_isr), 0, "interrupt outputs wrong");
+    zassert_true(data->recent_speed <= ACCEL_SPEED_LIMIT, "speed state out of range");
+
+    // The instance still matches the sequential calculation afterwards
+    test_reset(accel_dev);
+    memset(&shadow, 0, sizeof(shadow));
+    for (uint32_t n = 0; n < 16; n++) {
+        test_now_us += 1000;
+        int32_t in = test_delta(n);
+
+        zassert_equal(test_event(accel_dev, INPUT_EV_REL, test_code(n), in, true),
+                      test_expected(cfg, &shadow, test_code(n), in), "event %u after the run",
+                      n);
+    }
+}
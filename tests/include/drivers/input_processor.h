@@ -0,0 +1,38 @@
+// input_processor.h - Minimal copy of ZMK's input processor driver API
+// Shared by the host tools, the native_sim sample and the ztest suite, which
+// build the module without a ZMK tree; keep in sync with
+// zmk/app/include/drivers/input_processor.h
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <zephyr/device.h>
+#include <zephyr/input/input.h>
+
+#define ZMK_INPUT_PROC_CONTINUE 0
+#define ZMK_INPUT_PROC_STOP     1
+
+struct zmk_input_processor_state {
+    uint8_t input_device_index;
+    int16_t *remainder;
+};
+
+typedef int (*zmk_input_processor_handle_event_t)(const struct device *dev,
+                                                  struct input_event *event, uint32_t param1,
+                                                  uint32_t param2,
+                                                  struct zmk_input_processor_state *state);
+
+__subsystem struct zmk_input_processor_driver_api {
+    zmk_input_processor_handle_event_t handle_event;
+};
+
+static inline int zmk_input_processor_handle_event(const struct device *dev,
+                                                   struct input_event *event, uint32_t param1,
+                                                   uint32_t param2,
+                                                   struct zmk_input_processor_state *state) {
+    const struct zmk_input_processor_driver_api *api =
+        (const struct zmk_input_processor_driver_api *)dev->api;
+
+    return api->handle_event(dev, event, param1, param2, state);
+}
@@ -0,0 +1,91 @@
+// accel_host.c - Firmware processor instances for host tools
+//
+// Copyright (c) 2024 The ZMK Contributors
+// Modifications (c) 2025 NUOVOTAKA
+// SPDX-License-Identifier: MIT
+
+#include <string.h>
+#include <drivers/input_processor.h>
+#include "accel_host.h"
+#include "../../src/config/accel_config.h"
+
+const char *const accel_host_presets[ACCEL_HOST_PRESET_COUNT] = {
+    "office_optical", "office_laser", "office_trackball", "office_trackpad",
+    "gaming_optical", "gaming_laser", "gaming_trackball", "gaming_trackpad",
+    "high_sens_optical", "high_sens_laser", "high_sens_trackball", "high_sens_trackpad",
+};
+
+int accel_host_init(struct accel_host *host, uint8_t level, const char *preset) {
+    memset(host, 0, sizeof(*host));
+    host->dev.name = preset ? preset : "defaults";
+    host->dev.config = &host->cfg;
+    host->dev.data = &host->data;
+
+    int ret = accel_config_init(&host->cfg, level, 0);
+    if (ret < 0) {
+        return ret;
+    }
+    if (preset) {
+        ret = accel_config_apply_preset(&host->cfg, preset);
+        if (ret < 0) {
+            return ret;
+        }
+    }
+
+    // Same order as accel_init_device()
+    ret = accel_validate_config(&host->cfg);
+    if (ret < 0) {
+        return ret;
+    }
+#if !defined(CONFIG_INPUT_PROCESSOR_ACCEL_LAZY_STATE)
+    memset(&host->data, 0, sizeof(host->data));
+    host->data.last_time_ms = accel_clock_ms();
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_BUDGET)
+    accel_budget_build_lut(&host->cfg, &host->data);
+#endif
+#endif
+    // Counters are optional (only ACCEL_MAX_INSTANCES slots exist)
+    (void)accel_log_attach(&host->dev);
+    return accel_pipeline_build(&host->cfg);
+}
+
+int32_t accel_host_process(struct accel_host *host, uint16_t code, int32_t value, bool sync) {
+    struct input_event event = {
+        .dev = NULL,
+        .sync = sync,
+        .type = INPUT_EV_REL,
+        .code = code,
+        .value = value,
+    };
+
+    accel_handle_event(&host->dev, &event, 0, 0, NULL);
+    return event.value;
+}
+
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_CLOCK_HOOK)
+// Injected time source: the module never reads the shim kernel clock
+static uint64_t accel_host_time_us;
+
+static uint32_t accel_host_uptime_ms(void *user_data) {
+    return (uint32_t)(*(const uint64_t *)user_data / 1000);
+}
+
+static uint32_t accel_host_uptime_us(void *user_data) {
+    return (uint32_t)*(const uint64_t *)user_data;
+}
+
+static const struct accel_clock accel_host_clock = {
+    .uptime_ms = accel_host_uptime_ms,
+    .uptime_us = accel_host_uptime_us,
+    .user_data = &accel_host_time_us,
+};
+#endif
+
+void accel_host_set_time_us(uint64_t time_us) {
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_CLOCK_HOOK)
+    accel_host_time_us = ACCEL_HOST_TIME_ORIGIN_US + time_us;
+    (void)accel_set_clock(&accel_host_clock);
+#else
+    host_clock_set_us(ACCEL_HOST_TIME_ORIGIN_US + time_us);
+#endif
+}
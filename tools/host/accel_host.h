@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * Modifications (c) 2025 NUOVOTAKA
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+// Firmware processor instances for host tools
+// The module sources are compiled unchanged against the shim in shim/; an
+// instance goes through the same init steps as a DT instance
+
+#pragma once
+
+#include <stdbool.h>
+#include "../../include/drivers/input_processor_accel.h"
+
+#define ACCEL_HOST_PRESET_COUNT 12
+
+// Host clock origin: accel_clock_ms() == 0 means "no previous event"
+#define ACCEL_HOST_TIME_ORIGIN_US 1000000ULL
+
+extern const char *const accel_host_presets[ACCEL_HOST_PRESET_COUNT];
+
+/**
+ * One processor instance. Must not move after accel_host_init() (the
+ * instance's counters keep a pointer to dev).
+ */
+struct accel_host {
+    struct device dev;
+    struct accel_config cfg;
+    struct accel_data data;
+};
+
+/**
+ * @brief Initialize an instance like the device init path
+ * Level defaults, preset (NULL keeps the level defaults), validation,
+ * runtime data reset and pipeline build.
+ * @return 0 on success, negative ACCEL_ERR_* code on failure
+ */
+int accel_host_init(struct accel_host *host, uint8_t level, const char *preset);
+
+/**
+ * @brief Run one REL event through accel_handle_event()
+ * @return Processed value
+ */
+int32_t accel_host_process(struct accel_host *host, uint16_t code, int32_t value, bool sync);
+
+/**
+ * @brief Set the simulated clock (microseconds since the host time origin)
+ * With CONFIG_INPUT_PROCESSOR_ACCEL_CLOCK_HOOK the module reads it through
+ * accel_set_clock() instead of the shim kernel uptime.
+ */
+void accel_host_set_time_us(uint64_t time_us);
@@ -0,0 +1,229 @@
+// accuracy.c - Fixed-point error report against the double-precision reference
+// Sweeps input x speed x configuration and reports how far each integer
+// stage, and the whole firmware path, deviates from reference.c
+//
+// Usage: accuracy [exp|poly]  (Level 2 curve shape of the reference, default exp)
+//
+// Copyright (c) 2024 The ZMK Contributors
+// Modifications (c) 2025 NUOVOTAKA
+// SPDX-License-Identifier: MIT
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "accel_host.h"
+#include "reference.h"
+#include "../../src/config/accel_config_adapter.h"
+
+// Steady-stream sweep: reports before measuring (EMA settled) and measured
+#define ACC_WARMUP_REPORTS  40
+#define ACC_MEASURE_REPORTS 40
+
+static const uint32_t acc_rates_hz[] = {125, 250, 500, 1000};
+
+/**
+ * Absolute error statistics of one sweep. Factors are compared in
+ * thousandths (the firmware's unit), outputs in counts.
+ */
+struct acc_error {
+    double max;
+    double sum;
+    double signed_sum;
+    uint64_t count;
+    double worst_at;               // Sweep coordinate of the maximum
+};
+
+static void acc_add(struct acc_error *e, double firmware, double reference, double at) {
+    double diff = firmware - reference;
+    if (fabs(diff) > e->max || e->count == 0) {
+        e->max = fabs(diff);
+        e->worst_at = at;
+    }
+    e->sum += fabs(diff);
+    e->signed_sum += diff;
+    e->count++;
+}
+
+static double acc_mean(const struct acc_error *e) {
+    return e->count ? e->sum / e->count : 0.0;
+}
+
+static double acc_bias(const struct acc_error *e) {
+    return e->count ? e->signed_sum / e->count : 0.0;
+}
+
+// =============================================================================
+// STAGES
+// =============================================================================
+
+// DPI adjustment: every sensitivity x DPI in steps of 50
+static void acc_dpi(void) {
+    struct acc_error e[2] = {0};
+
+    for (uint8_t level = 1; level <= 2; level++) {
+        struct accel_host host;
+        accel_host_init(&host, level, NULL);
+        struct accel_config *cfg = &host.cfg;
+
+        for (uint32_t sens = MIN_SAFE_SENSITIVITY; sens <= MAX_SAFE_SENSITIVITY; sens++) {
+            if (level == 1) {
+                cfg->cfg.level1.sensitivity = (uint16_t)sens;
+            } else {
+                cfg->cfg.level2.sensitivity = (uint16_t)sens;
+            }
+            for (uint32_t dpi = SENSOR_DPI_MIN; dpi <= SENSOR_DPI_MAX; dpi += 50) {
+                accel_set_sensor_dpi(cfg, (uint16_t)dpi);
+                acc_add(&e[level - 1], calculate_dpi_adjusted_sensitivity(cfg),
+                        ref_dpi_sensitivity(cfg) * SENSITIVITY_SCALE, dpi);
+            }
+        }
+    }
+
+    printf("\nDPI adjustment (sensitivity %u..%u x DPI %u..%u, thousandths)\n",
+           MIN_SAFE_SENSITIVITY, MAX_SAFE_SENSITIVITY, SENSOR_DPI_MIN, SENSOR_DPI_MAX);
+    printf("%-2s %8s %8s %8s %9s\n", "L", "max", "mean", "bias", "worst@dpi");
+    for (int i = 0; i < 2; i++) {
+        printf("%-2d %8.3f %8.3f %+8.3f %9.0f\n", i + 1, e[i].max, acc_mean(&e[i]),
+               acc_bias(&e[i]), e[i].worst_at);
+    }
+}
+
+// Level 1 curve factor: each curve type x max-factor, every input magnitude
+static void acc_simple_curve(void) {
+    static const char *const names[] = {"linear", "mild", "strong"};
+    struct accel_host host;
+    accel_host_init(&host, 1, NULL);
+    struct accel_config *cfg = &host.cfg;
+
+    printf("\nLevel 1 curve factor (max-factor %u..%u, input 2..%u, thousandths)\n",
+           MAX_FACTOR_MIN, MAX_FACTOR_MAX, MAX_SAFE_INPUT_VALUE);
+    printf("%-8s %8s %8s %8s %11s\n", "curve", "max", "mean", "bias", "worst@input");
+
+    for (uint8_t curve = CURVE_TYPE_MIN; curve <= CURVE_TYPE_MAX; curve++) {
+        struct acc_error e = {0};
+        cfg->cfg.level1.curve_type = curve;
+        for (uint32_t max_factor = MAX_FACTOR_MIN; max_factor <= MAX_FACTOR_MAX;
+             max_factor += 100) {
+            cfg->cfg.level1.max_factor = (uint16_t)max_factor;
+            for (int32_t input = 2; input <= MAX_SAFE_INPUT_VALUE; input++) {
+                acc_add(&e, accel_simple_curve_factor(cfg, input),
+                        ref_simple_curve_factor(cfg, input) * SENSITIVITY_SCALE, input);
+            }
+        }
+        printf("%-8s %8.3f %8.3f %+8.3f %11.0f\n", names[curve], e.max, acc_mean(&e),
+               acc_bias(&e), e.worst_at);
+    }
+}
+
+// Level 2 speed factor: each exponent on every preset's speed range, every speed
+static void acc_speed_curve(void) {
+    printf("\nLevel 2 speed factor (12 presets, speed 0..%u, thousandths)\n",
+           (unsigned)ACCEL_SPEED_LIMIT);
+    printf("%-3s | %8s %8s %8s | %8s %8s %8s %11s\n", "exp", "poly:max", "mean", "bias",
+           "exp:max", "mean", "bias", "worst@speed");
+
+    for (uint8_t exponent = 1; exponent <= 5; exponent++) {
+        struct acc_error poly = {0};
+        struct acc_error expo = {0};
+
+        for (int p = 0; p < ACCEL_HOST_PRESET_COUNT; p++) {
+            struct accel_host host;
+            accel_host_init(&host, 2, accel_host_presets[p]);
+            struct accel_config *cfg = &host.cfg;
+            cfg->cfg.level2.acceleration_exponent = exponent;
+
+            for (uint32_t speed = 0; speed <= ACCEL_SPEED_LIMIT; speed++) {
+                double factor = accel_standard_speed_factor(cfg, speed);
+                acc_add(&poly, factor,
+                        ref_standard_speed_factor(cfg, speed, REF_CURVE_POLY) * SENSITIVITY_SCALE,
+                        speed);
+                acc_add(&expo, factor,
+                        ref_standard_speed_factor(cfg, speed, REF_CURVE_EXP) * SENSITIVITY_SCALE,
+                        speed);
+            }
+        }
+        printf("%-3u | %8.3f %8.3f %+8.3f | %8.3f %8.3f %+8.3f %11.0f\n", exponent, poly.max,
+               acc_mean(&poly), acc_bias(&poly), expo.max, acc_mean(&expo), acc_bias(&expo),
+               expo.worst_at);
+    }
+}
+
+// =============================================================================
+// FIRMWARE PATH
+// =============================================================================
+
+/**
+ * Steady diagonal streams (n counts on X and Y per report, 1 <= n <= 200)
+ * through the full handler. The reference follows the same events with the
+ * floating-point speed estimator on exact event times. Events the firmware
+ * hands to its fallback formula (speed above MAX_REASONABLE_SPEED) and outputs
+ * beyond the emergency brake are skipped: those are limits, not approximations.
+ */
+static int acc_path(uint8_t level, const char *preset, uint32_t rate_hz, enum ref_curve shape) {
+    struct acc_error out = {0};
+    struct acc_error speed = {0};
+    uint32_t interval_us = 1000000U / rate_hz;
+
+    for (int32_t n = 1; n <= MAX_REASONABLE_INPUT; n++) {
+        struct accel_host host;
+        struct ref_speed ref = {0};
+        if (accel_host_init(&host, level, preset) < 0) {
+            return -1;
+        }
+
+        for (uint32_t k = 0; k < ACC_WARMUP_REPORTS + ACC_MEASURE_REPORTS; k++) {
+            uint64_t time_us = (uint64_t)(k + 1) * interval_us;
+            double time_s = (ACCEL_HOST_TIME_ORIGIN_US + time_us) / 1e6;
+            bool measure = k >= ACC_WARMUP_REPORTS;
+            accel_host_set_time_us(time_us);
+
+            for (int axis = 0; axis < 2; axis++) {
+                uint16_t code = axis ? INPUT_REL_Y : INPUT_REL_X;
+                int32_t value = accel_host_process(&host, code, n, axis == 1);
+                double ref_speed = ref_speed_update(&ref, n, time_s);
+                double expected = (level == 1) ? ref_simple_calculate(&host.cfg, n, code) :
+                    ref_standard_calculate(&host.cfg, n, ref_speed, code, shape);
+
+                if (!measure || fabs(expected) > EMERGENCY_BRAKE_THRESHOLD ||
+                    (level == 2 && host.data.recent_speed > MAX_REASONABLE_SPEED)) {
+                    continue;
+                }
+                acc_add(&out, value, expected, n);
+                if (level == 2 && ref_speed > 0) {
+                    acc_add(&speed, 100.0 * host.data.recent_speed / ref_speed, 100.0, n);
+                }
+            }
+        }
+    }
+
+    printf("%-2u %-20s %5u | %7.2f | %7.2f %7.3f %+7.3f %6.0f\n", level, preset, rate_hz,
+           acc_mean(&speed), out.max, acc_mean(&out), acc_bias(&out), out.worst_at);
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    enum ref_curve shape = (argc > 1 && strcmp(argv[1], "poly") == 0) ? REF_CURVE_POLY :
+        REF_CURVE_EXP;
+
+    printf("accuracy: firmware fixed point vs double-precision reference (%s curves)\n",
+           shape == REF_CURVE_EXP ? "documented exponential" : "firmware polynomial");
+
+    acc_dpi();
+    acc_simple_curve();
+    acc_speed_curve();
+
+    printf("\nFirmware path, steady diagonal streams (input 1..%u per axis, counts)\n",
+           MAX_REASONABLE_INPUT);
+    printf("%-2s %-20s %5s | %7s | %7s %7s %7s %6s\n", "L", "preset", "rate", "speed%",
+           "max", "mean", "bias", "worst@");
+    for (uint8_t level = 1; level <= 2; level++) {
+        for (int p = 0; p < ACCEL_HOST_PRESET_COUNT; p++) {
+            for (size_t r = 0; r < ARRAY_SIZE(acc_rates_hz); r++) {
+                if (acc_path(level, accel_host_presets[p], acc_rates_hz[r], shape) < 0) {
+                    printf("%-2u %-20s | failed\n", level, accel_host_presets[p]);
+                }
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,214 @@
+// constcheck.c - Compile-time configuration against the runtime init
+// Built with CONFIG_INPUT_PROCESSOR_ACCEL_CONST_CONFIG, one level symbol and
+// one Kconfig preset (or PRESET_CUSTOM, with or without ACCEL_HOST_DT_CUSTOM
+// properties), so the module defines one devicetree instance with a const
+// configuration. The check compares it field by field with an instance
+// initialized at runtime from the same settings, then runs trajectories
+// through both and compares every output.
+//
+// Usage: constcheck (make check-const builds and runs every combination)
+//
+// Copyright (c) 2024 The ZMK Contributors
+// Modifications (c) 2025 NUOVOTAKA
+// SPDX-License-Identifier: MIT
+
+#include <stdio.h>
+#include <string.h>
+#include <zephyr/devicetree.h>
+#include <drivers/input_processor.h>
+#include "accel_host.h"
+#include "trajectory.h"
+#include "../../src/config/accel_config_adapter.h"
+
+#if !defined(CONFIG_INPUT_PROCESSOR_ACCEL_CONST_CONFIG)
+#error "constcheck needs CONFIG_INPUT_PROCESSOR_ACCEL_CONST_CONFIG"
+#endif
+
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_LEVEL_STANDARD)
+#define CC_LEVEL 2
+#else
+#define CC_LEVEL 1
+#endif
+
+// Runtime preset matching the Kconfig choice (NULL: level defaults)
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_PRESET_OFFICE_OPTICAL)
+#define CC_PRESET "office_optical"
+#elif defined(CONFIG_INPUT_PROCESSOR_ACCEL_PRESET_OFFICE_LASER)
+#define CC_PRESET "office_laser"
+#elif defined(CONFIG_INPUT_PROCESSOR_ACCEL_PRESET_OFFICE_TRACKBALL)
+#define CC_PRESET "office_trackball"
+#elif defined(CONFIG_INPUT_PROCESSOR_ACCEL_PRESET_OFFICE_TRACKPAD)
+#define CC_PRESET "office_trackpad"
+#elif defined(CONFIG_INPUT_PROCESSOR_ACCEL_PRESET_GAMING_OPTICAL)
+#define CC_PRESET "gaming_optical"
+#elif defined(CONFIG_INPUT_PROCESSOR_ACCEL_PRESET_GAMING_LASER)
+#define CC_PRESET "gaming_laser"
+#elif defined(CONFIG_INPUT_PROCESSOR_ACCEL_PRESET_GAMING_TRACKBALL)
+#define CC_PRESET "gaming_trackball"
+#elif defined(CONFIG_INPUT_PROCESSOR_ACCEL_PRESET_GAMING_TRACKPAD)
+#define CC_PRESET "gaming_trackpad"
+#elif defined(CONFIG_INPUT_PROCESSOR_ACCEL_PRESET_HIGH_SENS_OPTICAL)
+#define CC_PRESET "high_sens_optical"
+#elif defined(CONFIG_INPUT_PROCESSOR_ACCEL_PRESET_HIGH_SENS_LASER)
+#define CC_PRESET "high_sens_laser"
+#elif defined(CONFIG_INPUT_PROCESSOR_ACCEL_PRESET_HIGH_SENS_TRACKBALL)
+#define CC_PRESET "high_sens_trackball"
+#elif defined(CONFIG_INPUT_PROCESSOR_ACCEL_PRESET_HIGH_SENS_TRACKPAD)
+#define CC_PRESET "high_sens_trackpad"
+#else
+#define CC_PRESET NULL
+#endif
+
+#if defined(ACCEL_HOST_DT_CUSTOM)
+#define CC_NAME "dt-custom"
+#else
+#define CC_NAME (CC_PRESET ? CC_PRESET : "defaults")
+#endif
+
+static int cc_mismatches;
+
+#define CC_FIELD(c, r, field)                                                                   \
+    do {                                                                                        \
+        if ((c)->field != (r)->field) {                                                         \
+            printf("   %s: const %ld, runtime %ld\n", #field, (long)(c)->field,                 \
+                   (long)(r)->field);                                                           \
+            cc_mismatches++;                                                                    \
+        }                                                                                       \
+    } while (0)
+
+// Custom devicetree properties, applied like the runtime DT init
+static void cc_apply_dt(struct accel_config *cfg) {
+#if defined(ACCEL_HOST_DT_CUSTOM)
+    if (cfg->level == 1) {
+        cfg->cfg.level1.sensitivity = ACCEL_HOST_DT_sensitivity;
+        cfg->cfg.level1.max_factor = ACCEL_HOST_DT_max_factor;
+        cfg->cfg.level1.curve_type = ACCEL_HOST_DT_curve_type;
+    } else {
+        cfg->cfg.level2.sensitivity = ACCEL_HOST_DT_sensitivity;
+        cfg->cfg.level2.max_factor = ACCEL_HOST_DT_max_factor;
+        cfg->cfg.level2.speed_threshold = ACCEL_HOST_DT_speed_threshold;
+        cfg->cfg.level2.speed_max = ACCEL_HOST_DT_speed_max;
+        cfg->cfg.level2.min_factor = ACCEL_HOST_DT_min_factor;
+        cfg->cfg.level2.acceleration_exponent = ACCEL_HOST_DT_acceleration_exponent;
+    }
+    cfg->y_boost_scaled = (ACCEL_HOST_DT_y_boost - SENSITIVITY_SCALE) / 10;
+    accel_set_sensor_dpi(cfg, ACCEL_HOST_DT_sensor_dpi);
+#else
+    ARG_UNUSED(cfg);
+#endif
+}
+
+static void cc_compare_config(const struct accel_config *c, const struct accel_config *r) {
+    CC_FIELD(c, r, level);
+    CC_FIELD(c, r, input_type);
+    CC_FIELD(c, r, y_boost_scaled);
+    CC_FIELD(c, r, sensor_dpi);
+    CC_FIELD(c, r, dpi_sensitivity);
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_WIDE_RANGE)
+    CC_FIELD(c, r, prescale_q16);
+#endif
+    CC_FIELD(c, r, stage_count);
+    if (c->level == 1) {
+        CC_FIELD(c, r, cfg.level1.sensitivity);
+        CC_FIELD(c, r, cfg.level1.max_factor);
+        CC_FIELD(c, r, cfg.level1.curve_type);
+    } else {
+        CC_FIELD(c, r, cfg.level2.sensitivity);
+        CC_FIELD(c, r, cfg.level2.max_factor);
+        CC_FIELD(c, r, cfg.level2.min_factor);
+        CC_FIELD(c, r, cfg.level2.speed_threshold);
+        CC_FIELD(c, r, cfg.level2.speed_max);
+        CC_FIELD(c, r, cfg.level2.acceleration_exponent);
+    }
+    for (uint8_t i = 0; i < c->stage_count && i < r->stage_count; i++) {
+        if (c->stages[i] != r->stages[i]) {
+            printf("   stages[%u] differs\n", i);
+            cc_mismatches++;
+        }
+    }
+    // accel_host_init() leaves the codes unset; device init assigns these
+    static const uint16_t default_codes[] = {INPUT_REL_X, INPUT_REL_Y, INPUT_REL_WHEEL,
+                                             INPUT_REL_HWHEEL};
+    if (c->codes_count != ARRAY_SIZE(default_codes) ||
+        memcmp(c->codes, default_codes, sizeof(default_codes)) != 0) {
+        printf("   codes differ from the default REL codes\n");
+        cc_mismatches++;
+    }
+}
+
+static int32_t cc_process(const struct device *dev, uint16_t code, int32_t value, bool sync) {
+    struct input_event event = {
+        .dev = NULL,
+        .sync = sync,
+        .type = INPUT_EV_REL,
+        .code = code,
+        .value = value,
+    };
+
+    accel_handle_event(dev, &event, 0, 0, NULL);
+    return event.value;
+}
+
+// Every trajectory kind through both instances, event by event
+static void cc_compare_output(struct accel_host *host) {
+    uint64_t events = 0;
+
+    for (int kind = 0; kind < TRAJ_KIND_COUNT; kind++) {
+        struct traj_params params = {
+            .kind = (enum traj_kind)kind,
+            .rate_hz = 1000,
+            .dpi = host->cfg.sensor_dpi,
+            .duration_ms = 5000,
+            .seed = 1,
+        };
+        struct traj_stream stream;
+
+        if (traj_generate(&params, &stream) < 0) {
+            printf("   %s: trajectory generation failed\n", traj_kind_name(params.kind));
+            cc_mismatches++;
+            continue;
+        }
+        for (size_t i = 0; i < stream.count; i++) {
+            const struct traj_event *ev = &stream.events[i];
+            accel_host_set_time_us((uint64_t)kind * 10000000ULL + ev->time_us);
+            int32_t c = cc_process(&accel_host_dt_device, ev->code, ev->value, ev->sync);
+            int32_t r = accel_host_process(host, ev->code, ev->value, ev->sync);
+            events++;
+            if (c != r) {
+                printf("   %s event %zu (code %u, in %d): const %d, runtime %d\n",
+                       traj_kind_name(params.kind), i, ev->code, ev->value, c, r);
+                cc_mismatches++;
+                break;
+            }
+        }
+        traj_free(&stream);
+    }
+    printf("   %llu events compared\n", (unsigned long long)events);
+}
+
+int main(void) {
+    static struct accel_host host;
+
+    accel_host_set_time_us(0);
+    printf("constcheck: level %d, %s\n", CC_LEVEL, CC_NAME);
+
+    int ret = accel_host_dt_init(&accel_host_dt_device);
+    if (ret != 0) {
+        printf("   const init returned %d\n", ret);
+        cc_mismatches++;
+    }
+    ret = accel_host_init(&host, CC_LEVEL, CC_PRESET);
+    if (ret < 0) {
+        printf("   runtime init returned %d\n", ret);
+        return 1;
+    }
+    cc_apply_dt(&host.cfg);
+    // Same start as the const instance: zeroed data, speed tracking from the first event
+    host.data.last_time_ms = 0;
+
+    cc_compare_config(accel_host_dt_device.config, &host.cfg);
+    cc_compare_output(&host);
+
+    printf("%s\n", cc_mismatches ? "MISMATCH" : "const and runtime configuration identical");
+    return cc_mismatches ? 1 : 0;
+}
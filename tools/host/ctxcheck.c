@@ -0,0 +1,166 @@
+// ctxcheck.c - Runtime contexts against the device they share a configuration with
+// Built with CONFIG_INPUT_PROCESSOR_ACCEL_CONTEXTS. For every preset at both
+// levels, takes every context from the slab and checks:
+// - a further create fails, and so does one without a device
+// - contexts fed the device's events give the device's output, event by
+//   event, while another context processes a different stream
+// - a destroyed block is the one the next create returns, with reset state
+// - accel_context_count() follows each create and destroy
+//
+// Usage: ctxcheck
+//
+// Copyright (c) 2024 The ZMK Contributors
+// Modifications (c) 2025 NUOVOTAKA
+// SPDX-License-Identifier: MIT
+
+#include <stdio.h>
+#include <drivers/input_processor.h>
+#include "accel_host.h"
+#include "trajectory.h"
+
+#if !defined(CONFIG_INPUT_PROCESSOR_ACCEL_CONTEXTS)
+#error "ctxcheck needs CONFIG_INPUT_PROCESSOR_ACCEL_CONTEXTS"
+#endif
+
+#define CTX_COUNT CONFIG_INPUT_PROCESSOR_ACCEL_CONTEXT_COUNT
+
+// Context fed a different stream (doubled, opposite direction)
+#define CTX_OTHER 1
+
+static int ctx_failures;
+
+#define CTX_EXPECT(cond, ...)                                                                   \
+    do {                                                                                        \
+        if (!(cond)) {                                                                          \
+            printf("   ");                                                                      \
+            printf(__VA_ARGS__);                                                                \
+            printf("\n");                                                                       \
+            ctx_failures++;                                                                     \
+        }                                                                                       \
+    } while (0)
+
+static int32_t ctx_process(struct accel_context *ctx, uint16_t code, int32_t value, bool sync) {
+    struct input_event event = {
+        .dev = NULL,
+        .sync = sync,
+        .type = INPUT_EV_REL,
+        .code = code,
+        .value = value,
+    };
+
+    int ret = accel_context_handle_event(ctx, &event);
+    CTX_EXPECT(ret == ZMK_INPUT_PROC_CONTINUE, "accel_context_handle_event() returned %d", ret);
+    return event.value;
+}
+
+// Every trajectory kind through the device and all contexts
+static uint64_t ctx_compare_output(struct accel_host *host, struct accel_context **ctx) {
+    uint64_t events = 0;
+
+    for (int kind = 0; kind < TRAJ_KIND_COUNT; kind++) {
+        struct traj_params params = {
+            .kind = (enum traj_kind)kind,
+            .rate_hz = 1000,
+            .dpi = host->cfg.sensor_dpi,
+            .duration_ms = 2000,
+            .seed = 1,
+        };
+        struct traj_stream stream;
+
+        if (traj_generate(&params, &stream) < 0) {
+            CTX_EXPECT(0, "%s: trajectory generation failed", traj_kind_name(params.kind));
+            continue;
+        }
+        for (size_t i = 0; i < stream.count; i++) {
+            const struct traj_event *ev = &stream.events[i];
+            accel_host_set_time_us((uint64_t)kind * 10000000ULL + ev->time_us);
+            int32_t expected = accel_host_process(host, ev->code, ev->value, ev->sync);
+            for (int c = 0; c < CTX_COUNT; c++) {
+                if (c == CTX_OTHER) {
+                    (void)ctx_process(ctx[c], ev->code, -2 * ev->value, ev->sync);
+                    continue;
+                }
+                int32_t out = ctx_process(ctx[c], ev->code, ev->value, ev->sync);
+                if (out != expected) {
+                    CTX_EXPECT(0, "context %d, %s event %zu (code %u, in %d): %d, device %d", c,
+                               traj_kind_name(params.kind), i, ev->code, ev->value, out,
+                               expected);
+                    i = stream.count;
+                    break;
+                }
+            }
+            events++;
+        }
+        traj_free(&stream);
+    }
+    return events;
+}
+
+// Slab limits, output against the device, then reuse of a freed block
+static void ctx_run(struct accel_host *host, struct accel_context **ctx) {
+    struct accel_context *extra = accel_context_create(&host->dev);
+    CTX_EXPECT(extra == NULL, "create beyond the slab (%d) succeeded", CTX_COUNT);
+    accel_context_destroy(extra);
+    CTX_EXPECT(accel_context_create(NULL) == NULL, "create without a device succeeded");
+
+    uint64_t events = ctx_compare_output(host, ctx);
+
+    // The freed block comes back first, reset like a new device
+    struct accel_context *freed = ctx[CTX_OTHER];
+    accel_context_destroy(freed);
+    CTX_EXPECT(accel_context_count() == CTX_COUNT - 1, "count %u after destroy",
+               accel_context_count());
+    ctx[CTX_OTHER] = accel_context_create(&host->dev);
+    CTX_EXPECT(ctx[CTX_OTHER] == freed, "create after destroy returned another block");
+    CTX_EXPECT(ctx[CTX_OTHER] && ctx[CTX_OTHER]->data.recent_speed == 0 &&
+                   ctx[CTX_OTHER]->data.last_time_ms == accel_clock_ms(),
+               "reused block not reset");
+
+    printf("   %llu events compared\n", (unsigned long long)events);
+}
+
+static void ctx_check(uint8_t level, const char *preset) {
+    static struct accel_host host;
+    struct accel_context *ctx[CTX_COUNT] = {NULL};
+    int before = ctx_failures;
+    int created = 0;
+
+    printf("level %u, %s\n", level, preset);
+    accel_host_set_time_us(0);
+    if (accel_host_init(&host, level, preset) < 0) {
+        CTX_EXPECT(0, "init failed");
+        return;
+    }
+
+    while (created < CTX_COUNT && (ctx[created] = accel_context_create(&host.dev)) != NULL) {
+        created++;
+        CTX_EXPECT(accel_context_count() == (uint32_t)created, "count %u after %d creates",
+                   accel_context_count(), created);
+    }
+    CTX_EXPECT(created == CTX_COUNT, "only %d of %d creates succeeded", created, CTX_COUNT);
+    if (created == CTX_COUNT) {
+        ctx_run(&host, ctx);
+    }
+
+    for (int c = 0; c < CTX_COUNT; c++) {
+        accel_context_destroy(ctx[c]);
+    }
+    CTX_EXPECT(accel_context_count() == 0, "count %u after destroying all",
+               accel_context_count());
+    if (ctx_failures != before) {
+        printf("   FAIL\n");
+    }
+}
+
+int main(void) {
+    printf("ctxcheck: %d contexts per device\n", CTX_COUNT);
+
+    for (uint8_t level = 1; level <= 2; level++) {
+        for (int p = 0; p < ACCEL_HOST_PRESET_COUNT; p++) {
+            ctx_check(level, accel_host_presets[p]);
+        }
+    }
+
+    printf("\n%s\n", ctx_failures ? "FAIL" : "contexts match the device; slab limits and reuse ok");
+    return ctx_failures ? 1 : 0;
+}
@@ -0,0 +1,424 @@
+// domaincheck.c - Exhaustive domain verification of the calculation functions
+// Enumerates every input for accel_simple_calculate() and every input x
+// reachable speed state for accel_standard_calculate(), for each preset and
+// for the corners of the configurable ranges, on all cores
+//
+// Usage: domaincheck [threads (0 = all cores)] [speed_step (1 = exhaustive)]
+//
+// Copyright (c) 2024 The ZMK Contributors
+// Modifications (c) 2025 NUOVOTAKA
+// SPDX-License-Identifier: MIT
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "accel_host.h"
+#include "../../src/config/accel_config_adapter.h"
+
+#define DC_MAX_CONFIGS 128
+#define DC_EXAMPLE_LEN 120
+
+// Speed states the EMA can hold without being reset as corrupt
+#define DC_SPEED_STATES (ACCEL_SPEED_LIMIT / 2 + 1)
+
+// Host clock while checking (milliseconds since the host time origin)
+#define DC_NOW_MS 10000U
+
+// FNV-1a over each unit's outputs, in enumeration order
+#define DC_FNV_OFFSET 0xcbf29ce484222325ULL
+#define DC_FNV_PRIME  0x100000001b3ULL
+
+/**
+ * Level 2 time classes. Elapsed time only enters the speed estimate through
+ * the current sample (|input| * 1000 / dt, or |input| * 10 after a pause),
+ * so the shortest interval and a pause bound every reachable speed.
+ */
+enum dc_time_class {
+    DC_TIME_1MS,
+    DC_TIME_PAUSE,
+    DC_TIME_COUNT,
+};
+
+enum dc_property {
+    DC_SIGN,                       // Output never has the opposite sign (0 -> 0)
+    DC_BOUNDS,                     // Output within INT16_MIN..INT16_MAX
+    DC_REJECT,                     // Inputs beyond MAX_EXTREME_INPUT produce 0
+    DC_MONO_INPUT,                 // |output| non-decreasing in |input| (same state)
+    DC_MONO_SPEED,                 // |output| non-decreasing in the speed state (same input)
+    DC_PROPERTY_COUNT,
+};
+
+static const char *const dc_property_names[DC_PROPERTY_COUNT] = {
+    [DC_SIGN] = "sign",
+    [DC_BOUNDS] = "int16 bounds",
+    [DC_REJECT] = "rejection",
+    [DC_MONO_INPUT] = "monotonic in |input|",
+    [DC_MONO_SPEED] = "monotonic in speed",
+};
+
+struct dc_config {
+    char name[48];
+    struct accel_config cfg;
+    // Results, merged under dc_lock
+    uint64_t evaluated;
+    uint64_t violations[DC_PROPERTY_COUNT];
+    char example[DC_PROPERTY_COUNT][DC_EXAMPLE_LEN];
+    uint64_t guards[ACCEL_LOG_EVENT_COUNT];
+    uint64_t checksum;             // Sum of the unit hashes (order-independent)
+};
+
+// One unit of work: a config, one axis, one input sign and (Level 2) one time class
+struct dc_unit {
+    struct dc_config *config;
+    uint16_t code;
+    int8_t sign;
+    uint8_t time_class;
+};
+
+static struct dc_config dc_configs[DC_MAX_CONFIGS];
+static int dc_config_count;
+static struct dc_unit *dc_units;
+static int dc_unit_count;
+static int dc_next_unit;
+static uint32_t dc_speed_step = 1;
+static pthread_mutex_t dc_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// =============================================================================
+// CONFIGURATIONS
+// =============================================================================
+
+static void dc_add_config(const struct accel_config *cfg, const char *name) {
+    if (dc_config_count >= DC_MAX_CONFIGS || accel_validate_config(cfg) < 0) {
+        return;
+    }
+    struct dc_config *config = &dc_configs[dc_config_count++];
+    memset(config, 0, sizeof(*config));
+    snprintf(config->name, sizeof(config->name), "%s", name);
+    config->cfg = *cfg;
+    config->cfg.log = NULL;
+}
+
+static void dc_add_presets(uint8_t level) {
+    for (int p = 0; p < ACCEL_HOST_PRESET_COUNT; p++) {
+        struct accel_host host;
+        if (accel_host_init(&host, level, accel_host_presets[p]) == 0) {
+            dc_add_config(&host.cfg, accel_host_presets[p]);
+        }
+    }
+}
+
+/**
+ * Corners of the Kconfig ranges. Sensitivity and DPI only act through the
+ * DPI-adjusted sensitivity, so they enter as its two extremes.
+ */
+static const struct {
+    uint16_t sensitivity;
+    uint16_t dpi;
+} dc_gain_corners[] = {{200, 8000}, {2000, 400}};
+static const uint16_t dc_max_factor_corners[] = {1000, 5000};
+
+static void dc_add_level1_corners(void) {
+    for (size_t g = 0; g < ARRAY_SIZE(dc_gain_corners); g++) {
+        for (size_t m = 0; m < ARRAY_SIZE(dc_max_factor_corners); m++) {
+            for (uint8_t curve = CURVE_TYPE_MIN; curve <= CURVE_TYPE_MAX; curve++) {
+                struct accel_host host;
+                char name[48];
+                accel_host_init(&host, 1, NULL);
+                host.cfg.cfg.level1.sensitivity = dc_gain_corners[g].sensitivity;
+                host.cfg.cfg.level1.max_factor = dc_max_factor_corners[m];
+                host.cfg.cfg.level1.curve_type = curve;
+                accel_set_sensor_dpi(&host.cfg, dc_gain_corners[g].dpi);
+                snprintf(name, sizeof(name), "s%u/%u m%u c%u", dc_gain_corners[g].sensitivity,
+                         dc_gain_corners[g].dpi, dc_max_factor_corners[m], curve);
+                dc_add_config(&host.cfg, name);
+            }
+        }
+    }
+}
+
+static void dc_add_level2_corners(void) {
+    static const uint16_t min_factors[] = {200, 1500};
+    static const uint16_t speed_ranges[][2] = {{100, 1000}, {2000, 8000}};
+    static const uint8_t exponents[] = {1, 5};
+    static const uint16_t y_boosts[] = {1000, 3000};
+
+    for (size_t g = 0; g < ARRAY_SIZE(dc_gain_corners); g++)
+    for (size_t m = 0; m < ARRAY_SIZE(dc_max_factor_corners); m++)
+    for (size_t f = 0; f < ARRAY_SIZE(min_factors); f++)
+    for (size_t r = 0; r < ARRAY_SIZE(speed_ranges); r++)
+    for (size_t e = 0; e < ARRAY_SIZE(exponents); e++)
+    for (size_t y = 0; y < ARRAY_SIZE(y_boosts); y++) {
+        struct accel_host host;
+        char name[64];
+        accel_host_init(&host, 2, NULL);
+        host.cfg.cfg.level2.sensitivity = dc_gain_corners[g].sensitivity;
+        host.cfg.cfg.level2.max_factor = dc_max_factor_corners[m];
+        host.cfg.cfg.level2.min_factor = min_factors[f];
+        host.cfg.cfg.level2.speed_threshold = speed_ranges[r][0];
+        host.cfg.cfg.level2.speed_max = speed_ranges[r][1];
+        host.cfg.cfg.level2.acceleration_exponent = exponents[e];
+        accel_set_y_boost(&host.cfg, y_boosts[y]);
+        accel_set_sensor_dpi(&host.cfg, dc_gain_corners[g].dpi);
+        snprintf(name, sizeof(name), "s%u/%u m%u f%u t%u-%u e%u y%u",
+                 dc_gain_corners[g].sensitivity, dc_gain_corners[g].dpi,
+                 dc_max_factor_corners[m], min_factors[f], speed_ranges[r][0],
+                 speed_ranges[r][1], exponents[e], y_boosts[y]);
+        // min_factor above max_factor fails validation and is skipped
+        dc_add_config(&host.cfg, name);
+    }
+}
+
+// =============================================================================
+// CHECKING
+// =============================================================================
+
+struct dc_tally {
+    uint64_t evaluated;
+    uint64_t violations[DC_PROPERTY_COUNT];
+    char example[DC_PROPERTY_COUNT][DC_EXAMPLE_LEN];
+    uint64_t checksum;
+};
+
+static void dc_violation(struct dc_tally *t, enum dc_property property, int32_t input,
+                         uint32_t speed, int32_t out, const int32_t *prev) {
+    if (t->violations[property]++ > 0) {
+        return;
+    }
+    int len = snprintf(t->example[property], DC_EXAMPLE_LEN, "input %d, speed state %u: output %d",
+                       input, speed, out);
+    if (prev && len > 0 && len < DC_EXAMPLE_LEN) {
+        snprintf(t->example[property] + len, DC_EXAMPLE_LEN - len, ", previous %d", *prev);
+    }
+}
+
+// Properties of one output; prev is the output one step lower in |input| or speed
+static void dc_check(struct dc_tally *t, int32_t input, uint32_t speed, int32_t out,
+                     const int32_t *prev_input, const int32_t *prev_speed) {
+    t->evaluated++;
+    t->checksum = (t->checksum ^ (uint32_t)out) * DC_FNV_PRIME;
+
+    if ((input == 0 && out != 0) || (input > 0 && out < 0) || (input < 0 && out > 0)) {
+        dc_violation(t, DC_SIGN, input, speed, out, NULL);
+    }
+    if (out > INT16_MAX || out < INT16_MIN) {
+        dc_violation(t, DC_BOUNDS, input, speed, out, NULL);
+    }
+    if (abs(input) > MAX_EXTREME_INPUT) {
+        if (out != 0) {
+            dc_violation(t, DC_REJECT, input, speed, out, NULL);
+        }
+        return;
+    }
+    if (prev_input && abs(out) < abs(*prev_input)) {
+        dc_violation(t, DC_MONO_INPUT, input, speed, out, prev_input);
+    }
+    if (prev_speed && abs(out) < abs(*prev_speed)) {
+        dc_violation(t, DC_MONO_SPEED, input, speed, out, prev_speed);
+    }
+}
+
+static void dc_run_level1(const struct accel_config *cfg, const struct dc_unit *unit,
+                          struct dc_tally *t) {
+    int32_t prev = 0;
+    for (int32_t magnitude = 0; magnitude <= MAX_SAFE_INPUT_VALUE; magnitude++) {
+        int32_t input = magnitude * unit->sign;
+        int32_t out = accel_simple_calculate(cfg, input, unit->code);
+        dc_check(t, input, 0, out, magnitude ? &prev : NULL, NULL);
+        prev = out;
+    }
+}
+
+/**
+ * Level 2: every input magnitude x every speed state. The previous magnitude's
+ * row is kept so both directions of monotonicity are checked in one pass.
+ */
+static int dc_run_level2(const struct accel_config *cfg, const struct dc_unit *unit,
+                         struct dc_tally *t) {
+    uint32_t states = (DC_SPEED_STATES + dc_speed_step - 1) / dc_speed_step;
+    int32_t *prev_row = malloc(states * sizeof(int32_t));
+    if (!prev_row) {
+        return -1;
+    }
+    uint32_t elapsed_ms = (unit->time_class == DC_TIME_1MS) ? 1 : SPEED_CALC_TIME_LIMIT_MS;
+    struct accel_data data;
+    memset(&data, 0, sizeof(data));
+
+    for (int32_t magnitude = 0; magnitude <= MAX_SAFE_INPUT_VALUE; magnitude++) {
+        int32_t input = magnitude * unit->sign;
+        int32_t prev_out = 0;
+        for (uint32_t i = 0; i < states; i++) {
+            uint32_t speed = i * dc_speed_step;
+            data.recent_speed = (accel_speed_t)speed;
+            data.last_time_ms = ACCEL_HOST_TIME_ORIGIN_US / 1000 + DC_NOW_MS - elapsed_ms;
+            int32_t out = accel_standard_calculate(cfg, &data, input, unit->code);
+            dc_check(t, input, speed, out, magnitude ? &prev_row[i] : NULL,
+                     i ? &prev_out : NULL);
+            prev_row[i] = out;
+            prev_out = out;
+        }
+    }
+    free(prev_row);
+    return 0;
+}
+
+static void *dc_worker(void *arg) {
+    struct accel_log_state log;
+    struct dc_tally *t = malloc(sizeof(*t));
+    ARG_UNUSED(arg);
+    if (!t) {
+        return NULL;
+    }
+
+    for (;;) {
+        int index = __atomic_fetch_add(&dc_next_unit, 1, __ATOMIC_RELAXED);
+        if (index >= dc_unit_count) {
+            break;
+        }
+        const struct dc_unit *unit = &dc_units[index];
+        struct dc_config *config = unit->config;
+
+        // Private copy: the guard counters are per thread
+        struct accel_config cfg = config->cfg;
+        memset(&log, 0, sizeof(log));
+        memset(t, 0, sizeof(*t));
+        t->checksum = DC_FNV_OFFSET;
+        cfg.log = &log;
+
+        if (cfg.level == 1) {
+            dc_run_level1(&cfg, unit, t);
+        } else if (dc_run_level2(&cfg, unit, t) < 0) {
+            fprintf(stderr, "domaincheck: out of memory\n");
+            exit(2);
+        }
+
+        pthread_mutex_lock(&dc_lock);
+        config->evaluated += t->evaluated;
+        config->checksum += t->checksum;
+        for (int p = 0; p < DC_PROPERTY_COUNT; p++) {
+            if (t->violations[p] && !config->violations[p]) {
+                memcpy(config->example[p], t->example[p], DC_EXAMPLE_LEN);
+            }
+            config->violations[p] += t->violations[p];
+        }
+        for (int e = 0; e < ACCEL_LOG_EVENT_COUNT; e++) {
+            config->guards[e] += (uint64_t)atomic_get(&log.counts[e]);
+        }
+        pthread_mutex_unlock(&dc_lock);
+    }
+    free(t);
+    return NULL;
+}
+
+static void dc_build_units(void) {
+    dc_units = calloc((size_t)dc_config_count * 2 * 2 * DC_TIME_COUNT, sizeof(*dc_units));
+    if (!dc_units) {
+        fprintf(stderr, "domaincheck: out of memory\n");
+        exit(2);
+    }
+
+    for (int c = 0; c < dc_config_count; c++) {
+        int time_classes = (dc_configs[c].cfg.level == 2) ? DC_TIME_COUNT : 1;
+        for (int axis = 0; axis < 2; axis++) {
+            for (int sign = -1; sign <= 1; sign += 2) {
+                for (int tc = 0; tc < time_classes; tc++) {
+                    dc_units[dc_unit_count++] = (struct dc_unit){
+                        .config = &dc_configs[c],
+                        .code = axis ? INPUT_REL_Y : INPUT_REL_X,
+                        .sign = (int8_t)sign,
+                        .time_class = (uint8_t)tc,
+                    };
+                }
+            }
+        }
+    }
+}
+
+// =============================================================================
+// REPORT
+// =============================================================================
+
+static int dc_report(void) {
+    int failed = 0;
+    uint64_t checksum = 0;
+
+    printf("%-2s %-40s %12s | %6s %6s %6s %8s %8s | %8s %8s %8s | %16s\n", "L", "config",
+           "evaluated", "sign", "int16", "reject", "mono:in", "mono:spd", "overflow", "clamped",
+           "fallback", "outputs");
+    for (int c = 0; c < dc_config_count; c++) {
+        const struct dc_config *config = &dc_configs[c];
+        checksum = checksum * DC_FNV_PRIME + config->checksum;
+        printf("%-2u %-40s %12llu | %6llu %6llu %6llu %8llu %8llu | %8llu %8llu %8llu | %016llx\n",
+               config->cfg.level, config->name, (unsigned long long)config->evaluated,
+               (unsigned long long)config->violations[DC_SIGN],
+               (unsigned long long)config->violations[DC_BOUNDS],
+               (unsigned long long)config->violations[DC_REJECT],
+               (unsigned long long)config->violations[DC_MONO_INPUT],
+               (unsigned long long)config->violations[DC_MONO_SPEED],
+               (unsigned long long)config->guards[ACCEL_LOG_OVERFLOW],
+               (unsigned long long)config->guards[ACCEL_LOG_CLAMPED],
+               (unsigned long long)(config->guards[ACCEL_LOG_SUSPICIOUS] +
+                                    config->guards[ACCEL_LOG_SPEED_FALLBACK]),
+               (unsigned long long)config->checksum);
+    }
+    printf("\nOutput checksum: %016llx\n", (unsigned long long)checksum);
+
+    printf("\nFirst violation per config and property:\n");
+    for (int c = 0; c < dc_config_count; c++) {
+        const struct dc_config *config = &dc_configs[c];
+        for (int p = 0; p < DC_PROPERTY_COUNT; p++) {
+            if (config->violations[p]) {
+                printf("  L%u %-40s %-22s %s\n", config->cfg.level, config->name,
+                       dc_property_names[p], config->example[p]);
+                failed = 1;
+            }
+        }
+    }
+    if (!failed) {
+        printf("  none\n");
+    }
+    return failed;
+}
+
+int main(int argc, char **argv) {
+    long threads = (argc > 1) ? strtol(argv[1], NULL, 0) : 0;
+    if (threads <= 0) {
+        threads = sysconf(_SC_NPROCESSORS_ONLN);
+    }
+    threads = (threads > 0) ? threads : 1;
+    if (argc > 2) {
+        dc_speed_step = (uint32_t)strtoul(argv[2], NULL, 0);
+        dc_speed_step = dc_speed_step ? dc_speed_step : 1;
+    }
+
+    // All checks see the same, fixed uptime
+    accel_host_set_time_us((uint64_t)DC_NOW_MS * 1000);
+
+    dc_add_presets(1);
+    dc_add_level1_corners();
+    dc_add_presets(2);
+    dc_add_level2_corners();
+    dc_build_units();
+
+    printf("domaincheck: %d configs, %d work units, %ld threads, input -%d..%d, "
+           "speed states 0..%u step %u\n", dc_config_count, dc_unit_count, threads,
+           MAX_SAFE_INPUT_VALUE, MAX_SAFE_INPUT_VALUE, DC_SPEED_STATES - 1, dc_speed_step);
+    fflush(stdout);
+
+    pthread_t *ids = calloc((size_t)threads, sizeof(*ids));
+    if (!ids) {
+        return 2;
+    }
+    for (long i = 0; i < threads; i++) {
+        pthread_create(&ids[i], NULL, dc_worker, NULL);
+    }
+    for (long i = 0; i < threads; i++) {
+        pthread_join(ids[i], NULL);
+    }
+    free(ids);
+
+    int failed = dc_report();
+    free(dc_units);
+    return failed;
+}
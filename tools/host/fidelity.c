@@ -0,0 +1,354 @@
+// fidelity.c - Trajectory fidelity benchmark for every preset
+// Runs synthetic trajectories through the firmware processor and compares
+// the output with an ideal reference accelerator
+//
+// Usage: fidelity [rate_hz] [dpi (0 = each preset's)] [duration_ms] [seed]
+//
+// Copyright (c) 2024 The ZMK Contributors
+// Modifications (c) 2025 NUOVOTAKA
+// SPDX-License-Identifier: MIT
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "accel_host.h"
+#include "trajectory.h"
+
+// Idle time that separates two movements (overshoot metric)
+#define FID_STOP_MS 15
+// Movements shorter than this (reference counts) are ignored for overshoot
+#define FID_MIN_MOVEMENT 20.0
+// Lag search window, reports
+#define FID_LAG_MIN -5
+#define FID_LAG_MAX 40
+
+/**
+ * Per-report series of one run. The reference is an isotropic accelerator
+ * with the instance's own static curve, applied without speed smoothing,
+ * clamping or integer truncation to the ideal (unquantized) hand motion:
+ *   Level 1: gain(counts per report), Level 2: gain(true 2D speed)
+ * Differences against it are the distortion the firmware adds.
+ */
+struct fid_series {
+    uint32_t reports;
+    int32_t *in_x;                 // Sensor counts
+    int32_t *in_y;
+    int32_t *out_x;                // Firmware output
+    int32_t *out_y;
+    double *ideal_x;               // Ideal cumulative position (counts)
+    double *ideal_y;
+    double *ref_x;                 // Reference output per report
+    double *ref_y;
+};
+
+struct fid_metrics {
+    double path_err;               // Output vs reference path length, %
+    double lag;                    // Output speed profile delay, reports
+    double overshoot;              // Mean overshoot at stops, % of movement
+    double end_err;                // Mean |endpoint error| at stops, %
+    double jitter_amp;             // Path gain at rest / reference low-speed gain
+};
+
+static int fid_series_alloc(struct fid_series *s, uint32_t reports) {
+    s->reports = reports;
+    s->in_x = calloc(reports, sizeof(int32_t));
+    s->in_y = calloc(reports, sizeof(int32_t));
+    s->out_x = calloc(reports, sizeof(int32_t));
+    s->out_y = calloc(reports, sizeof(int32_t));
+    s->ideal_x = calloc(reports, sizeof(double));
+    s->ideal_y = calloc(reports, sizeof(double));
+    s->ref_x = calloc(reports, sizeof(double));
+    s->ref_y = calloc(reports, sizeof(double));
+    return (s->in_x && s->in_y && s->out_x && s->out_y && s->ideal_x && s->ideal_y &&
+            s->ref_x && s->ref_y) ? 0 : -1;
+}
+
+static void fid_series_free(struct fid_series *s) {
+    free(s->in_x);
+    free(s->in_y);
+    free(s->out_x);
+    free(s->out_y);
+    free(s->ideal_x);
+    free(s->ideal_y);
+    free(s->ref_x);
+    free(s->ref_y);
+}
+
+// =============================================================================
+// REFERENCE
+// =============================================================================
+
+static double fid_reference_gain(const struct accel_config *cfg, double counts_per_report,
+                                 uint32_t rate_hz) {
+    double sensitivity = calculate_dpi_adjusted_sensitivity(cfg) / 1000.0;
+    double factor = 1000.0;
+
+    if (cfg->level == 1) {
+        // Level 1 curve is defined on integer input sizes above 1: interpolate
+        if (counts_per_report > 1.0) {
+            double n = fmin(counts_per_report, MAX_SAFE_INPUT_VALUE - 1);
+            int32_t lo = (int32_t)n;
+            double f_lo = (lo > 1) ? accel_simple_curve_factor(cfg, lo) : 1000.0;
+            double f_hi = accel_simple_curve_factor(cfg, lo + 1);
+            factor = f_lo + (f_hi - f_lo) * (n - lo);
+        }
+    } else {
+        double speed = fmin(counts_per_report * rate_hz, (double)UINT32_MAX);
+        factor = accel_standard_speed_factor(cfg, (uint32_t)speed);
+    }
+    return sensitivity * factor / 1000.0;
+}
+
+static void fid_reference(const struct accel_config *cfg, struct fid_series *s, uint32_t rate_hz) {
+    double y_boost = (cfg->level == 2) ? accel_decode_y_boost(cfg->y_boost_scaled) / 1000.0 : 1.0;
+    double prev_x = 0.0;
+    double prev_y = 0.0;
+
+    for (uint32_t k = 0; k < s->reports; k++) {
+        double dx = s->ideal_x[k] - prev_x;
+        double dy = s->ideal_y[k] - prev_y;
+        double gain = fid_reference_gain(cfg, hypot(dx, dy), rate_hz);
+        s->ref_x[k] = gain * dx;
+        s->ref_y[k] = gain * dy * y_boost;
+        prev_x = s->ideal_x[k];
+        prev_y = s->ideal_y[k];
+    }
+}
+
+// =============================================================================
+// RUN
+// =============================================================================
+
+static void fid_run(struct accel_host *host, const struct traj_stream *stream, uint32_t rate_hz,
+                    struct fid_series *s) {
+    // Unset slots inherit the previous ideal position
+    for (uint32_t k = 0; k < s->reports; k++) {
+        s->ideal_x[k] = NAN;
+        s->ideal_y[k] = NAN;
+    }
+
+    for (size_t i = 0; i < stream->count; i++) {
+        const struct traj_event *ev = &stream->events[i];
+        // time_us = floor(k * 1e6 / rate), so k = ceil(time_us * rate / 1e6)
+        uint64_t k = ((uint64_t)ev->time_us * rate_hz + 999999) / 1000000;
+        if (k >= s->reports) {
+            continue;
+        }
+
+        accel_host_set_time_us(ev->time_us);
+        int32_t out = accel_host_process(host, ev->code, ev->value, ev->sync);
+        if (ev->code == TRAJ_REL_X) {
+            s->in_x[k] += ev->value;
+            s->out_x[k] += out;
+            s->ideal_x[k] = ev->ideal;
+        } else if (ev->code == TRAJ_REL_Y) {
+            s->in_y[k] += ev->value;
+            s->out_y[k] += out;
+            s->ideal_y[k] = ev->ideal;
+        }
+    }
+
+    double x = 0.0;
+    double y = 0.0;
+    for (uint32_t k = 0; k < s->reports; k++) {
+        x = isnan(s->ideal_x[k]) ? x : s->ideal_x[k];
+        y = isnan(s->ideal_y[k]) ? y : s->ideal_y[k];
+        s->ideal_x[k] = x;
+        s->ideal_y[k] = y;
+    }
+}
+
+// =============================================================================
+// METRICS
+// =============================================================================
+
+static double fid_path_error(const struct fid_series *s) {
+    double out = 0.0;
+    double ref = 0.0;
+
+    for (uint32_t k = 0; k < s->reports; k++) {
+        out += hypot(s->out_x[k], s->out_y[k]);
+        ref += hypot(s->ref_x[k], s->ref_y[k]);
+    }
+    return (ref > 0.0) ? (out - ref) / ref * 100.0 : 0.0;
+}
+
+// Shift of the output speed profile that best matches the reference
+static double fid_lag(const struct fid_series *s) {
+    double corr[FID_LAG_MAX - FID_LAG_MIN + 1];
+    int best = 0;
+
+    for (int lag = FID_LAG_MIN; lag <= FID_LAG_MAX; lag++) {
+        double sum = 0.0;
+        for (uint32_t k = 0; k < s->reports; k++) {
+            int64_t j = (int64_t)k + lag;
+            if (j < 0 || j >= s->reports) {
+                continue;
+            }
+            sum += hypot(s->ref_x[k], s->ref_y[k]) * hypot(s->out_x[j], s->out_y[j]);
+        }
+        corr[lag - FID_LAG_MIN] = sum;
+        if (sum > corr[best]) {
+            best = lag - FID_LAG_MIN;
+        }
+    }
+
+    // Parabolic refinement around the peak
+    double lag = best + FID_LAG_MIN;
+    if (best > 0 && best < FID_LAG_MAX - FID_LAG_MIN) {
+        double a = corr[best - 1];
+        double b = corr[best];
+        double c = corr[best + 1];
+        double denom = a - 2.0 * b + c;
+        if (denom != 0.0) {
+            lag += 0.5 * (a - c) / denom;
+        }
+    }
+    return lag;
+}
+
+// Endpoint error of each movement along its direction
+static void fid_stops(const struct fid_series *s, uint32_t rate_hz, double *overshoot,
+                      double *end_err) {
+    uint32_t stop_reports = MAX(1U, rate_hz * FID_STOP_MS / 1000);
+    double ref_x = 0.0;
+    double ref_y = 0.0;
+    double out_x = 0.0;
+    double out_y = 0.0;
+    double over_sum = 0.0;
+    double err_sum = 0.0;
+    uint32_t movements = 0;
+    uint32_t idle = 0;
+    bool moving = false;
+
+    for (uint32_t k = 0; k <= s->reports; k++) {
+        bool active = (k < s->reports) &&
+                      (s->ref_x[k] != 0.0 || s->ref_y[k] != 0.0 || s->out_x[k] || s->out_y[k]);
+        if (active) {
+            moving = true;
+            idle = 0;
+            ref_x += s->ref_x[k];
+            ref_y += s->ref_y[k];
+            out_x += s->out_x[k];
+            out_y += s->out_y[k];
+            continue;
+        }
+        if (!moving || (++idle < stop_reports && k < s->reports)) {
+            continue;
+        }
+
+        // Movement ended
+        double length = hypot(ref_x, ref_y);
+        if (length >= FID_MIN_MOVEMENT) {
+            double along = (out_x * ref_x + out_y * ref_y) / length;
+            double error = (along - length) / length;
+            over_sum += fmax(error, 0.0);
+            err_sum += fabs(error);
+            movements++;
+        }
+        ref_x = ref_y = out_x = out_y = 0.0;
+        moving = false;
+    }
+
+    *overshoot = movements ? over_sum / movements * 100.0 : 0.0;
+    *end_err = movements ? err_sum / movements * 100.0 : 0.0;
+}
+
+// Output path gain with the hand at rest, relative to the reference low-speed gain
+static double fid_jitter_amplification(const struct accel_config *cfg, const struct fid_series *s,
+                                       uint32_t rate_hz) {
+    double in = 0.0;
+    double out = 0.0;
+
+    for (uint32_t k = 0; k < s->reports; k++) {
+        in += hypot(s->in_x[k], s->in_y[k]);
+        out += hypot(s->out_x[k], s->out_y[k]);
+    }
+    double gain = fid_reference_gain(cfg, 1.0, rate_hz);
+    return (in > 0.0 && gain > 0.0) ? out / in / gain : 0.0;
+}
+
+static int fid_measure(uint8_t level, const char *preset, const struct traj_stream *stream,
+                       const struct traj_params *params, enum traj_kind kind,
+                       struct fid_metrics *m) {
+    struct accel_host host;
+    struct fid_series s;
+
+    accel_host_set_time_us(0);
+    if (accel_host_init(&host, level, preset) < 0) {
+        return -1;
+    }
+    if (fid_series_alloc(&s, stream->reports) < 0) {
+        fid_series_free(&s);
+        return -1;
+    }
+
+    fid_run(&host, stream, params->rate_hz, &s);
+    fid_reference(&host.cfg, &s, params->rate_hz);
+
+    if (kind == TRAJ_JITTER) {
+        m->jitter_amp = fid_jitter_amplification(&host.cfg, &s, params->rate_hz);
+    } else {
+        m->path_err = fid_path_error(&s);
+        m->lag = fid_lag(&s);
+        fid_stops(&s, params->rate_hz, &m->overshoot, &m->end_err);
+    }
+
+    fid_series_free(&s);
+    return 0;
+}
+
+// Fidelity of one preset: each trajectory at the preset's sensor DPI unless overridden
+static int fid_preset(uint8_t level, const char *preset, struct traj_params params) {
+    static const enum traj_kind kinds[] = {TRAJ_FLICK, TRAJ_DRAG, TRAJ_CIRCLE, TRAJ_JITTER};
+    struct fid_metrics m[ARRAY_SIZE(kinds)] = {0};
+    struct accel_host host;
+
+    if (accel_host_init(&host, level, preset) < 0) {
+        return -1;
+    }
+    if (params.dpi == 0) {
+        params.dpi = host.cfg.sensor_dpi;
+    }
+
+    for (size_t i = 0; i < ARRAY_SIZE(kinds); i++) {
+        struct traj_stream stream;
+        params.kind = kinds[i];
+        if (traj_generate(&params, &stream) < 0) {
+            return -1;
+        }
+        int ret = fid_measure(level, preset, &stream, &params, kinds[i], &m[i]);
+        traj_free(&stream);
+        if (ret < 0) {
+            return ret;
+        }
+    }
+
+    printf("%-2u %-20s %5u | %+11.1f %7.2f %7.1f | %9.1f | %+10.1f %7.2f | %7.2f\n", level,
+           preset, params.dpi, m[0].path_err, m[0].lag, m[0].overshoot, m[1].end_err,
+           m[2].path_err, m[2].lag, m[3].jitter_amp);
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    struct traj_params params = {
+        .rate_hz = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : 1000,
+        .dpi = (argc > 2) ? (uint32_t)strtoul(argv[2], NULL, 0) : 0,
+        .duration_ms = (argc > 3) ? (uint32_t)strtoul(argv[3], NULL, 0) : 20000,
+        .seed = (argc > 4) ? strtoull(argv[4], NULL, 0) : 1,
+    };
+
+    printf("fidelity: %u Hz, %s DPI, %u ms per trajectory, seed %llu\n", params.rate_hz,
+           params.dpi ? argv[2] : "preset", params.duration_ms, (unsigned long long)params.seed);
+    printf("%-2s %-20s %5s | %11s %7s %7s | %9s | %10s %7s | %7s\n", "L", "preset", "dpi",
+           "flick:path%", "lag", "over%", "drag:end%", "circ:path%", "lag", "jitter");
+
+    for (uint8_t level = 1; level <= 2; level++) {
+        for (int p = 0; p < ACCEL_HOST_PRESET_COUNT; p++) {
+            if (fid_preset(level, accel_host_presets[p], params) < 0) {
+                printf("%-2u %-20s | failed\n", level, accel_host_presets[p]);
+            }
+        }
+    }
+    return 0;
+}
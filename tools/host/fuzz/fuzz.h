@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * Modifications (c) 2025 NUOVOTAKA
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+// Helpers shared by the fuzz targets
+// Each target defines LLVMFuzzerTestOneInput(); it links against libFuzzer
+// (clang -fsanitize=fuzzer) or against fuzz_main.c (any compiler, AFL)
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../accel_host.h"
+#include "../../../src/config/accel_config_adapter.h"
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);
+
+/**
+ * Byte stream consumed front to back. Reads past the end return zeros, so
+ * every input is valid and short inputs still reach the code under test.
+ */
+struct fuzz_input {
+    const uint8_t *data;
+    size_t size;
+};
+
+static inline uint8_t fuzz_u8(struct fuzz_input *in) {
+    if (in->size == 0) {
+        return 0;
+    }
+    in->size--;
+    return *in->data++;
+}
+
+static inline uint16_t fuzz_u16(struct fuzz_input *in) {
+    uint16_t lo = fuzz_u8(in);
+    return (uint16_t)(lo | (uint16_t)fuzz_u8(in) << 8);
+}
+
+static inline uint32_t fuzz_u32(struct fuzz_input *in) {
+    uint32_t lo = fuzz_u16(in);
+    return lo | (uint32_t)fuzz_u16(in) << 16;
+}
+
+// Event codes the handler accepts, plus one it must ignore
+static inline uint16_t fuzz_code(struct fuzz_input *in) {
+    static const uint16_t codes[] = {INPUT_REL_X, INPUT_REL_Y, INPUT_REL_WHEEL,
+                                     INPUT_REL_HWHEEL, INPUT_REL_Z};
+    return codes[fuzz_u8(in) % ARRAY_SIZE(codes)];
+}
+
+/**
+ * @brief Arbitrary configuration of either level, straight from the input
+ * Every field takes any value of its type; the DPI goes through the setter
+ * so the cached adjusted sensitivity matches it, as in every firmware path.
+ */
+static inline void fuzz_config(struct fuzz_input *in, struct accel_config *cfg) {
+    memset(cfg, 0, sizeof(*cfg));
+    cfg->input_type = INPUT_EV_REL;
+    cfg->level = fuzz_u8(in);
+    cfg->cfg.level2.sensitivity = fuzz_u16(in);
+    cfg->cfg.level2.max_factor = fuzz_u16(in);
+    cfg->cfg.level2.speed_threshold = fuzz_u16(in);
+    cfg->cfg.level2.speed_max = fuzz_u16(in);
+    cfg->cfg.level2.min_factor = fuzz_u16(in);
+    cfg->cfg.level2.acceleration_exponent = fuzz_u8(in);
+    if (cfg->level == 1) {
+        // Level 1 reads its own union member; keep the curve type arbitrary too
+        cfg->cfg.level1.curve_type = fuzz_u8(in);
+    }
+    cfg->y_boost_scaled = fuzz_u8(in);
+    accel_set_sensor_dpi(cfg, fuzz_u16(in));
+}
+
+// Violated property: abort so both engines record the input as a crash
+#define FUZZ_CHECK(cond)                                                                      \
+    do {                                                                                      \
+        if (!(cond)) {                                                                        \
+            __builtin_trap();                                                                 \
+        }                                                                                     \
+    } while (0)
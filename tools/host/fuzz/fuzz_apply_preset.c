@@ -0,0 +1,33 @@
+// fuzz_apply_preset.c - Fuzz target for accel_config_apply_preset()
+// Arbitrary names on both levels; every preset that applies must validate
+//
+// Copyright (c) 2024 The ZMK Contributors
+// Modifications (c) 2025 NUOVOTAKA
+// SPDX-License-Identifier: MIT
+
+#include "fuzz.h"
+#include "../../../src/config/accel_config.h"
+
+#define FUZZ_NAME_MAX 64
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+    struct fuzz_input in = {data, size};
+    struct accel_config cfg;
+    char name[FUZZ_NAME_MAX + 1];
+
+    uint8_t level = fuzz_u8(&in);
+    size_t len = (in.size < FUZZ_NAME_MAX) ? in.size : FUZZ_NAME_MAX;
+    memcpy(name, in.data, len);
+    name[len] = '\0';
+
+    // Level defaults first, as at device init; levels other than 1/2 must fail
+    int ret = accel_config_init(&cfg, level, 0);
+    if (ret < 0) {
+        FUZZ_CHECK(level != 1 && level != 2);
+        return 0;
+    }
+    if (accel_config_apply_preset(&cfg, name) == 0) {
+        FUZZ_CHECK(accel_validate_config(&cfg) == 0);
+    }
+    return 0;
+}
@@ -0,0 +1,65 @@
+// fuzz_main.c - Standalone driver for the fuzz targets
+// Used when libFuzzer is not available (gcc, AFL, replaying crashes):
+//   fuzz_x                 one input from stdin (AFL: afl-fuzz ... -- fuzz_x)
+//   fuzz_x file...         each file once (corpus or crash reproduction)
+//   fuzz_x -r runs [seed]  random inputs of 0..512 bytes
+//
+// Copyright (c) 2024 The ZMK Contributors
+// Modifications (c) 2025 NUOVOTAKA
+// SPDX-License-Identifier: MIT
+
+#include <stdio.h>
+#include "fuzz.h"
+
+#define FUZZ_MAX_INPUT  (1 << 20)
+#define FUZZ_RANDOM_MAX 512
+
+static uint8_t fuzz_buf[FUZZ_MAX_INPUT];
+
+static int fuzz_run_stream(FILE *f) {
+    size_t size = fread(fuzz_buf, 1, sizeof(fuzz_buf), f);
+    return LLVMFuzzerTestOneInput(fuzz_buf, size);
+}
+
+// xorshift64*: reproducible across hosts for a given seed
+static uint64_t fuzz_next(uint64_t *state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 0x2545f4914f6cdd1dULL;
+}
+
+static int fuzz_run_random(unsigned long runs, uint64_t seed) {
+    uint64_t state = seed ? seed : 1;
+    for (unsigned long i = 0; i < runs; i++) {
+        size_t size = fuzz_next(&state) % (FUZZ_RANDOM_MAX + 1);
+        for (size_t b = 0; b < size; b++) {
+            fuzz_buf[b] = (uint8_t)fuzz_next(&state);
+        }
+        LLVMFuzzerTestOneInput(fuzz_buf, size);
+    }
+    printf("%lu random inputs, seed %llu: ok\n", runs, (unsigned long long)seed);
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    if (argc > 2 && strcmp(argv[1], "-r") == 0) {
+        unsigned long runs = strtoul(argv[2], NULL, 0);
+        uint64_t seed = (argc > 3) ? strtoull(argv[3], NULL, 0) : 1;
+        return fuzz_run_random(runs, seed);
+    }
+    if (argc < 2) {
+        return fuzz_run_stream(stdin);
+    }
+
+    for (int i = 1; i < argc; i++) {
+        FILE *f = fopen(argv[i], "rb");
+        if (!f) {
+            perror(argv[i]);
+            return 2;
+        }
+        fuzz_run_stream(f);
+        fclose(f);
+    }
+    return 0;
+}
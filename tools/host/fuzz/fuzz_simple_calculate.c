@@ -0,0 +1,33 @@
+// fuzz_simple_calculate.c - Fuzz target for accel_simple_calculate()
+// Arbitrary Level 1 configurations (validated ones only for the fast path)
+// and any 32-bit input
+//
+// Copyright (c) 2024 The ZMK Contributors
+// Modifications (c) 2025 NUOVOTAKA
+// SPDX-License-Identifier: MIT
+
+#include "fuzz.h"
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+    struct fuzz_input in = {data, size};
+    struct accel_config cfg;
+
+    fuzz_config(&in, &cfg);
+    cfg.level = 1;
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_FAST_PATH)
+    // The fast path's contract: only validated configurations reach it
+    if (accel_validate_config(&cfg) < 0) {
+        return 0;
+    }
+#endif
+
+    do {
+        uint16_t code = fuzz_code(&in);
+        int32_t value = (int32_t)fuzz_u32(&in);
+        int32_t out = accel_simple_calculate(&cfg, value, code);
+
+        FUZZ_CHECK(out >= INT16_MIN && out <= INT16_MAX);
+        FUZZ_CHECK(!(value > 0 && out < 0) && !(value < 0 && out > 0));
+    } while (in.size > 0);
+    return 0;
+}
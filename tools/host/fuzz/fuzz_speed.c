@@ -0,0 +1,39 @@
+// fuzz_speed.c - Fuzz target for accel_calculate_simple_speed()
+// The input drives the clock: any start time, forward steps of up to 65 ms
+// and occasional jumps in either direction (wrap-around included)
+//
+// Copyright (c) 2024 The ZMK Contributors
+// Modifications (c) 2025 NUOVOTAKA
+// SPDX-License-Identifier: MIT
+
+#include "fuzz.h"
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+    struct fuzz_input in = {data, size};
+    struct accel_data state;
+
+    memset(&state, 0, sizeof(state));
+    state.last_time_ms = fuzz_u32(&in);
+    // Any speed state the firmware can hold (accel_standard_calculate resets larger ones)
+    state.recent_speed = (accel_speed_t)(fuzz_u32(&in) % ((uint64_t)ACCEL_SPEED_LIMIT + 1));
+    uint64_t clock_us = (uint64_t)fuzz_u32(&in) * 1000;
+
+    do {
+        uint8_t step = fuzz_u8(&in);
+        if (step == 0xff) {
+            // Jump: any 32-bit uptime, before or after the previous event
+            clock_us = (uint64_t)fuzz_u32(&in) * 1000;
+        } else {
+            clock_us += (uint64_t)fuzz_u16(&in) * step / 255;
+        }
+        accel_host_set_time_us(clock_us - ACCEL_HOST_TIME_ORIGIN_US);
+
+        int32_t value = (int32_t)fuzz_u32(&in);
+        uint32_t speed = accel_calculate_simple_speed(&state, value);
+
+        FUZZ_CHECK(speed <= ACCEL_SPEED_LIMIT);
+        FUZZ_CHECK(speed == state.recent_speed);
+        FUZZ_CHECK(state.last_time_ms == accel_clock_ms());
+    } while (in.size > 0);
+    return 0;
+}
@@ -0,0 +1,42 @@
+// fuzz_standard_calculate.c - Fuzz target for accel_standard_calculate()
+// Arbitrary Level 2 configurations (validated ones only for the fast path),
+// arbitrary speed state and clock, any 32-bit input
+//
+// Copyright (c) 2024 The ZMK Contributors
+// Modifications (c) 2025 NUOVOTAKA
+// SPDX-License-Identifier: MIT
+
+#include "fuzz.h"
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+    struct fuzz_input in = {data, size};
+    struct accel_config cfg;
+    struct accel_data state;
+
+    fuzz_config(&in, &cfg);
+    cfg.level = 2;
+#if defined(CONFIG_INPUT_PROCESSOR_ACCEL_FAST_PATH)
+    // The fast path's contract: only validated configurations reach it
+    if (accel_validate_config(&cfg) < 0) {
+        return 0;
+    }
+#endif
+
+    // Any runtime state, including values the firmware never stores itself
+    memset(&state, 0, sizeof(state));
+    state.last_time_ms = fuzz_u32(&in);
+    state.recent_speed = (accel_speed_t)fuzz_u32(&in);
+    uint64_t clock_us = (uint64_t)fuzz_u32(&in) * 1000;
+
+    do {
+        clock_us += fuzz_u16(&in);
+        accel_host_set_time_us(clock_us - ACCEL_HOST_TIME_ORIGIN_US);
+        uint16_t code = fuzz_code(&in);
+        int32_t value = (int32_t)fuzz_u32(&in);
+        int32_t out = accel_standard_calculate(&cfg, &state, value, code);
+
+        FUZZ_CHECK(out >= INT16_MIN && out <= INT16_MAX);
+        FUZZ_CHECK(!(value > 0 && out < 0) && !(value < 0 && out > 0));
+    } while (in.size > 0);
+    return 0;
+}
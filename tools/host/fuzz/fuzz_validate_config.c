@@ -0,0 +1,46 @@
+// fuzz_validate_config.c - Fuzz target for accel_validate_config()
+// Arbitrary configurations; whatever validation accepts must then run the
+// full pipeline without undefined behaviour or out-of-range output
+//
+// Copyright (c) 2024 The ZMK Contributors
+// Modifications (c) 2025 NUOVOTAKA
+// SPDX-License-Identifier: MIT
+
+#include "fuzz.h"
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+    struct fuzz_input in = {data, size};
+    struct accel_host host;
+
+    memset(&host, 0, sizeof(host));
+    host.dev.name = "fuzz";
+    host.dev.config = &host.cfg;
+    host.dev.data = &host.data;
+    fuzz_config(&in, &host.cfg);
+
+    if (accel_validate_config(&host.cfg) < 0) {
+        return 0;
+    }
+    FUZZ_CHECK(host.cfg.level == 1 || host.cfg.level == 2);
+    FUZZ_CHECK(accel_pipeline_build(&host.cfg) == 0);
+
+    // Remaining bytes: (time step, code, value) events through the handler
+    uint64_t time_us = 0;
+    accel_host_set_time_us(time_us);
+    host.data.last_time_ms = accel_clock_ms();
+    while (in.size > 0) {
+        time_us += fuzz_u16(&in);
+        accel_host_set_time_us(time_us);
+        uint16_t code = fuzz_code(&in);
+        int32_t value = (int16_t)fuzz_u16(&in);
+        int32_t out = accel_host_process(&host, code, value, true);
+
+        FUZZ_CHECK(out >= INT16_MIN && out <= INT16_MAX);
+        if (code == INPUT_REL_Z) {
+            FUZZ_CHECK(out == value);
+        } else {
+            FUZZ_CHECK(!(value > 0 && out < 0) && !(value < 0 && out > 0));
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,194 @@
+// reference.c - Double-precision reference model of the acceleration math
+// Same structure, limits and defaults as the firmware calculation; only the
+// arithmetic differs
+//
+// Copyright (c) 2024 The ZMK Contributors
+// Modifications (c) 2025 NUOVOTAKA
+// SPDX-License-Identifier: MIT
+
+#include <math.h>
+#include <zephyr/input/input.h>
+#include "reference.h"
+
+#define REF_SCALE ((double)SENSITIVITY_SCALE)
+
+static double ref_clamp(double value, double lo, double hi) {
+    return (value < lo) ? lo : (value > hi) ? hi : value;
+}
+
+// =============================================================================
+// SHARED
+// =============================================================================
+
+double ref_dpi_sensitivity(const struct accel_config *cfg) {
+    double sensitivity = (cfg->level == 1) ? cfg->cfg.level1.sensitivity :
+        cfg->cfg.level2.sensitivity;
+    // Wide range: input above ACCEL_PRESCALE_DPI is pre-scaled to that DPI
+    double scale = (cfg->sensor_dpi > 0) ?
+        (double)STANDARD_DPI_REFERENCE / ACCEL_ADJUST_DPI(cfg->sensor_dpi) : 1.0;
+
+    double adjusted = sensitivity * scale;
+    if (scale < 1.0) {
+        adjusted = fmax(adjusted, sensitivity / FALLBACK_MAX_REDUCTION);
+    } else if (scale > 1.0) {
+        adjusted = fmin(adjusted, sensitivity * FALLBACK_MAX_INCREASE);
+    }
+    return ref_clamp(adjusted, MIN_SAFE_SENSITIVITY, MAX_SAFE_SENSITIVITY) / REF_SCALE;
+}
+
+double ref_y_boost(const struct accel_config *cfg, uint16_t code) {
+    if (cfg->level == 1 || code != INPUT_REL_Y) {
+        return 1.0;
+    }
+    return ref_clamp(accel_decode_y_boost(cfg->y_boost_scaled), 500, 3000) / REF_SCALE;
+}
+
+// =============================================================================
+// LEVEL 1
+// =============================================================================
+
+double ref_simple_curve_factor(const struct accel_config *cfg, double abs_input) {
+    double max_factor = ref_clamp(cfg->cfg.level1.max_factor, SENSITIVITY_SCALE,
+                                  MAX_SAFE_FACTOR) / REF_SCALE;
+    uint8_t curve_type = (cfg->cfg.level1.curve_type < 3) ? cfg->cfg.level1.curve_type : 1;
+    double add;
+
+    switch (curve_type) {
+    case 0:
+        add = abs_input * LINEAR_CURVE_MULTIPLIER / REF_SCALE;
+        break;
+    case 2:
+        add = abs_input * abs_input * CURVE_STRONG_QUAD_NUMERATOR /
+              CURVE_STRONG_QUAD_DENOMINATOR / REF_SCALE;
+        break;
+    default:
+        add = abs_input * abs_input * CURVE_MILD_QUAD_NUMERATOR /
+              CURVE_MILD_QUAD_DENOMINATOR / REF_SCALE;
+        break;
+    }
+    return ref_clamp(1.0 + add, 1.0, max_factor);
+}
+
+double ref_simple_calculate(const struct accel_config *cfg, double input, uint16_t code) {
+    ARG_UNUSED(code);
+    double abs_input = fabs(input);
+    if (abs_input > MAX_EXTREME_INPUT) {
+        return 0.0;
+    }
+    abs_input = fmin(abs_input, MAX_REASONABLE_INPUT);
+
+    // The firmware leaves single counts on the linear part of the curve
+    double factor = (abs_input > 1.0) ? ref_simple_curve_factor(cfg, abs_input) : 1.0;
+    double output = abs_input * ref_dpi_sensitivity(cfg) * factor;
+    return (input < 0) ? -output : output;
+}
+
+// =============================================================================
+// LEVEL 2
+// =============================================================================
+
+double ref_exponential_curve(double t, uint8_t exponent, enum ref_curve shape) {
+    t = ref_clamp(t, 0.0, 1.0);
+    exponent = (uint8_t)ref_clamp(exponent, 1, 5);
+    if (exponent == 1) {
+        return t;
+    }
+
+    if (shape == REF_CURVE_EXP) {
+        return expm1(exponent * t) / expm1(exponent);
+    }
+
+    // Firmware polynomials in normalized units (t = t_int / 1000)
+    static const double quad_div[6] = {
+        [2] = CURVE_MILD_DIVISOR, [3] = CURVE_MODERATE_QUAD_DIV,
+        [4] = CURVE_STRONG_QUAD_DIV, [5] = CURVE_AGGRESSIVE_QUAD_DIV,
+    };
+    static const double cubic_div[6] = {
+        [3] = CURVE_MODERATE_CUBIC_DIV, [4] = CURVE_STRONG_CUBIC_DIV,
+        [5] = CURVE_AGGRESSIVE_CUBIC_DIV,
+    };
+    double n = SPEED_NORMALIZATION;
+    double curve = t + t * t * n / quad_div[exponent];
+    if (cubic_div[exponent] > 0) {
+        curve += t * t * t * n * n / cubic_div[exponent];
+    }
+    return ref_clamp(curve, 0.0, 1.0);
+}
+
+double ref_standard_speed_factor(const struct accel_config *cfg, double speed,
+                                 enum ref_curve shape) {
+    double threshold = (cfg->cfg.level2.speed_threshold > 0) ?
+        cfg->cfg.level2.speed_threshold : DEFAULT_SPEED_THRESHOLD;
+    double speed_max = (cfg->cfg.level2.speed_max > threshold) ?
+        cfg->cfg.level2.speed_max : threshold + DEFAULT_SPEED_MAX_OFFSET;
+    double min_factor = cfg->cfg.level2.min_factor / REF_SCALE;
+    double max_factor = cfg->cfg.level2.max_factor / REF_SCALE;
+
+    // Base sensitivity below the threshold, as in the firmware
+    if (speed <= threshold) {
+        return 1.0;
+    }
+
+    double factor;
+    if (speed >= speed_max) {
+        factor = max_factor;
+    } else if (max_factor < min_factor) {
+        factor = min_factor;
+    } else {
+        double t = (speed - threshold) / (speed_max - threshold);
+        double curve = ref_exponential_curve(t, cfg->cfg.level2.acceleration_exponent, shape);
+        factor = min_factor + (max_factor - min_factor) * curve;
+    }
+
+    double safe_max = ref_clamp(cfg->cfg.level2.max_factor, SENSITIVITY_SCALE,
+                                MAX_SAFE_FACTOR) / REF_SCALE;
+    return ref_clamp(factor, min_factor, safe_max);
+}
+
+double ref_standard_calculate(const struct accel_config *cfg, double input, double speed,
+                              uint16_t code, enum ref_curve shape) {
+    double abs_input = fabs(input);
+    if (abs_input > MAX_EXTREME_INPUT) {
+        return 0.0;
+    }
+    abs_input = fmin(abs_input, MAX_REASONABLE_INPUT);
+
+    double output = abs_input * ref_dpi_sensitivity(cfg) *
+                    ref_standard_speed_factor(cfg, speed, shape) * ref_y_boost(cfg, code);
+    return (input < 0) ? -output : output;
+}
+
+double ref_speed_update(struct ref_speed *state, double abs_input, double time_s) {
+    double alpha = SPEED_MOVING_AVERAGE_ALPHA / (double)SPEED_MOVING_AVERAGE_BASE;
+    double limit_s = SPEED_CALC_TIME_LIMIT_MS / 1000.0;
+    double dt = time_s - state->last_time_s;
+    double current;
+
+    abs_input = fmin(abs_input, MAX_SAFE_INPUT_VALUE);
+
+    // The firmware discards a speed state above half the limit as corrupt
+    if (state->speed > ACCEL_SPEED_LIMIT / 2) {
+        state->started = 0;
+    }
+
+    // First event: same initial estimate as the firmware
+    if (!state->started || dt < 0) {
+        state->started = 1;
+        state->last_time_s = time_s;
+        state->speed = abs_input * ACCEL_SPEED_SCALE_FACTOR;
+        return state->speed;
+    }
+
+    if (dt > 0 && dt < limit_s) {
+        current = abs_input / dt;
+    } else {
+        // Long pause; zero dt is a second axis that has no interval of its own
+        // and is estimated the same way
+        current = abs_input * ACCEL_SPEED_SCALE_FACTOR;
+    }
+
+    current = fmin(current, ACCEL_SPEED_LIMIT);
+    state->speed = state->speed * (1.0 - alpha) + current * alpha;
+    state->last_time_s = time_s;
+    return state->speed;
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * Modifications (c) 2025 NUOVOTAKA
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+// Double-precision reference model of the acceleration math
+// Evaluates the curves the integer code is meant to implement, without
+// thousandths truncation, Q16 scales or integer speed state. Gains and
+// factors are plain ratios (1.0 = unity), outputs are unrounded counts.
+
+#pragma once
+
+#include <stdint.h>
+#include "../../include/drivers/input_processor_accel.h"
+
+/**
+ * Level 2 curve shape used by the reference
+ *   REF_CURVE_POLY: the firmware's polynomials (t + t^2/2 ...), evaluated
+ *                   exactly; differences are pure fixed-point error
+ *   REF_CURVE_EXP:  the documented curves, (e^(n*t) - 1) / (e^n - 1) for
+ *                   exponent n >= 2; differences include the approximation
+ */
+enum ref_curve {
+    REF_CURVE_POLY,
+    REF_CURVE_EXP,
+};
+
+/**
+ * Reference speed estimator: |input| / dt smoothed by the same EMA
+ * (alpha 0.3 per event), in floating point and on the exact event time
+ */
+struct ref_speed {
+    double speed;                  // Counts per second
+    double last_time_s;
+    int started;
+};
+
+/**
+ * @brief Sensitivity after the DPI adjustment (sensitivity * 800 / DPI, same limits)
+ */
+double ref_dpi_sensitivity(const struct accel_config *cfg);
+
+/**
+ * @brief Level 1 curve factor for an input magnitude (counts per report)
+ */
+double ref_simple_curve_factor(const struct accel_config *cfg, double abs_input);
+
+/**
+ * @brief Level 2 normalized curve, t in [0, 1] -> [0, 1]
+ */
+double ref_exponential_curve(double t, uint8_t exponent, enum ref_curve shape);
+
+/**
+ * @brief Level 2 speed factor for a speed in counts per second
+ */
+double ref_standard_speed_factor(const struct accel_config *cfg, double speed,
+                                 enum ref_curve shape);
+
+/**
+ * @brief Y boost of the instance (1.0 for Level 1, which applies none)
+ */
+double ref_y_boost(const struct accel_config *cfg, uint16_t code);
+
+/**
+ * @brief Level 1 output for one event (input clamped like the firmware)
+ */
+double ref_simple_calculate(const struct accel_config *cfg, double input, uint16_t code);
+
+/**
+ * @brief Level 2 output for one event at a given speed
+ */
+double ref_standard_calculate(const struct accel_config *cfg, double input, double speed,
+                              uint16_t code, enum ref_curve shape);
+
+/**
+ * @brief Feed one event into the reference speed estimator
+ * @return Smoothed speed after the event, counts per second
+ */
+double ref_speed_update(struct ref_speed *state, double abs_input, double time_s);
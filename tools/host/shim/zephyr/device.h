@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * Modifications (c) 2025 NUOVOTAKA
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <zephyr/kernel.h>
+
+struct device {
+    const char *name;
+    const void *config;
+    const void *api;
+    void *data;
+};
+
+// The devicetree instance (zephyr/devicetree.h) and its init function
+extern const struct device accel_host_dt_device;
+extern int (*const accel_host_dt_init)(const struct device *dev);
+
+#define DEVICE_DT_INST_DEFINE(inst, init_fn, pm, data_ptr, cfg_ptr, level, prio, api_ptr)       \
+    const struct device accel_host_dt_device = {                                               \
+        .name = "dt" #inst,                                                                     \
+        .config = (cfg_ptr),                                                                    \
+        .api = (api_ptr),                                                                       \
+        .data = (data_ptr),                                                                     \
+    };                                                                                          \
+    int (*const accel_host_dt_init)(const struct device *dev) = (init_fn);
@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * Modifications (c) 2025 NUOVOTAKA
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+// Host build shim: one devicetree instance (0), as on a keyboard with one
+// processor node. Only constcheck initializes it; other tools create their
+// instances directly. No optional properties or, with ACCEL_HOST_DT_CUSTOM,
+// the values below
+
+#pragma once
+
+#define DT_HAS_COMPAT_STATUS_OKAY(compat) 1
+
+#define DT_INST_FOREACH_STATUS_OKAY(fn) fn(0)
+#define DT_INST_NODE_HAS_PROP(inst, prop) 0
+
+#if defined(ACCEL_HOST_DT_CUSTOM)
+// In range for both levels
+#define ACCEL_HOST_DT_sensitivity           1234
+#define ACCEL_HOST_DT_max_factor            3100
+#define ACCEL_HOST_DT_curve_type            2
+#define ACCEL_HOST_DT_y_boost               1250
+#define ACCEL_HOST_DT_sensor_dpi            1600
+#define ACCEL_HOST_DT_speed_threshold       700
+#define ACCEL_HOST_DT_speed_max             4000
+#define ACCEL_HOST_DT_min_factor            800
+#define ACCEL_HOST_DT_acceleration_exponent 3
+#define DT_INST_PROP_OR(inst, prop, default_value) ACCEL_HOST_DT_##prop
+#else
+#define DT_INST_PROP_OR(inst, prop, default_value) (default_value)
+#endif
@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * Modifications (c) 2025 NUOVOTAKA
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <zephyr/device.h>
+#include <zephyr/kernel.h>
+
+#define INPUT_EV_REL     0x02
+#define INPUT_REL_X      0x00
+#define INPUT_REL_Y      0x01
+#define INPUT_REL_Z      0x02
+#define INPUT_REL_HWHEEL 0x06
+#define INPUT_REL_WHEEL  0x08
+
+struct input_event {
+    const struct device *dev;
+    uint8_t sync;
+    uint8_t type;
+    uint16_t code;
+    int32_t value;
+};
+
+// No input listeners on the host: reported events are dropped
+
+static inline int input_report(const struct device *dev, uint8_t type, uint16_t code,
+                               int32_t value, bool sync, k_timeout_t timeout) {
+    (void)dev; (void)type; (void)code; (void)value; (void)sync; (void)timeout;
+    return 0;
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * Modifications (c) 2025 NUOVOTAKA
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+// Host build shim: the subset of the Zephyr kernel API used by the module
+// Time comes from a simulated clock the host tools advance explicitly
+
+#pragma once
+
+#include <assert.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <errno.h>
+#include <string.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/util.h>
+
+#define __packed        __attribute__((packed))
+#define __aligned(x)    __attribute__((aligned(x)))
+#define __subsystem
+#define __ASSERT(x, ...)    assert(x)
+#define __ASSERT_NO_MSG(x)  assert(x)
+#define BUILD_ASSERT(x, ...) _Static_assert(x, "" __VA_ARGS__)
+
+typedef int64_t k_timeout_t;
+#define K_NO_WAIT  ((k_timeout_t)0)
+#define K_FOREVER  ((k_timeout_t)-1)
+#define K_MSEC(ms) ((k_timeout_t)(ms))
+#define K_PRIO_PREEMPT(x) (x)
+
+// Simulated clock (1 tick = 1 us, 1 cycle = 1 us)
+void host_clock_set_us(uint64_t us);
+uint64_t host_clock_get_us(void);
+
+static inline uint32_t k_uptime_get_32(void) { return (uint32_t)(host_clock_get_us() / 1000); }
+static inline int64_t k_uptime_get(void) { return (int64_t)(host_clock_get_us() / 1000); }
+static inline int64_t k_uptime_ticks(void) { return (int64_t)host_clock_get_us(); }
+static inline uint64_t k_ticks_to_us_floor64(uint64_t t) { return t; }
+static inline uint32_t k_cycle_get_32(void) { return (uint32_t)host_clock_get_us(); }
+static inline uint32_t k_cyc_to_us_floor32(uint32_t c) { return c; }
+
+// Single-threaded host tools: interrupts and locks are no-ops
+static inline unsigned int irq_lock(void) { return 0; }
+static inline void irq_unlock(unsigned int key) { (void)key; }
+
+// Fixed-block allocator with an intrusive free list, as in the kernel
+struct k_mem_slab {
+    char *buffer;
+    size_t block_size;
+    uint32_t num_blocks;
+    uint32_t num_used;
+    void *free_list;
+    bool ready;
+};
+#define Z_MEM_SLAB_BLOCK(size) (((size) + sizeof(void *) - 1) & ~(sizeof(void *) - 1))
+#define Z_MEM_SLAB_BUF(name, size, count, align)                                               \
+    static char __aligned(MAX(align, sizeof(void *)))                                          \
+        _k_mem_slab_buf_##name[(count) * Z_MEM_SLAB_BLOCK(size)]
+#define Z_MEM_SLAB_INIT(name, size, count)                                                     \
+    {_k_mem_slab_buf_##name, Z_MEM_SLAB_BLOCK(size), (count), 0, NULL, false}
+#define K_MEM_SLAB_DEFINE(name, size, count, align)                                            \
+    Z_MEM_SLAB_BUF(name, size, count, align);                                                  \
+    struct k_mem_slab name = Z_MEM_SLAB_INIT(name, size, count)
+#define K_MEM_SLAB_DEFINE_STATIC(name, size, count, align)                                     \
+    Z_MEM_SLAB_BUF(name, size, count, align);                                                  \
+    static struct k_mem_slab name = Z_MEM_SLAB_INIT(name, size, count)
+int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t t);
+void k_mem_slab_free(struct k_mem_slab *slab, void *mem);
+static inline uint32_t k_mem_slab_num_used_get(struct k_mem_slab *slab) { return slab->num_used; }
+
+struct k_work;
+typedef void (*k_work_handler_t)(struct k_work *work);
+struct k_work {
+    k_work_handler_t handler;
+};
+struct k_work_delayable {
+    struct k_work work;
+};
+#define K_WORK_DELAYABLE_DEFINE(name, work_handler)                                             \
+    struct k_work_delayable name = {.work = {.handler = (work_handler)}}
+static inline int k_work_schedule(struct k_work_delayable *dwork, k_timeout_t delay) {
+    (void)dwork; (void)delay; return 0;
+}
+
+struct k_sem {
+    int unused;
+};
+#define K_SEM_DEFINE(name, initial, limit) struct k_sem name
+static inline void k_sem_give(struct k_sem *sem) { (void)sem; }
+static inline int k_sem_take(struct k_sem *sem, k_timeout_t t) { (void)sem; (void)t; return 0; }
+
+#define K_THREAD_DEFINE(name, stack, entry, p1, p2, p3, prio, options, delay) int name
@@ -0,0 +1,23 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * Modifications (c) 2025 NUOVOTAKA
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+// Host build shim: logging compiles to nothing (arguments stay type-checked)
+
+#pragma once
+
+#include <zephyr/devicetree.h>
+
+static inline __attribute__((format(printf, 1, 2))) void host_log_discard(const char *fmt, ...) {
+    (void)fmt;
+}
+
+#define LOG_MODULE_REGISTER(...)
+#define LOG_MODULE_DECLARE(...)
+#define LOG_ERR(...) host_log_discard(__VA_ARGS__)
+#define LOG_WRN(...) host_log_discard(__VA_ARGS__)
+#define LOG_INF(...) host_log_discard(__VA_ARGS__)
+#define LOG_DBG(...) host_log_discard(__VA_ARGS__)
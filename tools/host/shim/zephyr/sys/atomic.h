@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * Modifications (c) 2025 NUOVOTAKA
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+// Host build shim: Zephyr atomics on GCC/Clang builtins
+
+#pragma once
+
+#include <stdbool.h>
+
+typedef long atomic_t;
+typedef long atomic_val_t;
+
+#define ATOMIC_INIT(i) (i)
+
+static inline atomic_val_t atomic_get(const atomic_t *t) { return __atomic_load_n(t, __ATOMIC_SEQ_CST); }
+static inline atomic_val_t atomic_set(atomic_t *t, atomic_val_t v) { return __atomic_exchange_n(t, v, __ATOMIC_SEQ_CST); }
+static inline atomic_val_t atomic_clear(atomic_t *t) { return atomic_set(t, 0); }
+static inline atomic_val_t atomic_add(atomic_t *t, atomic_val_t v) { return __atomic_fetch_add(t, v, __ATOMIC_SEQ_CST); }
+static inline atomic_val_t atomic_inc(atomic_t *t) { return atomic_add(t, 1); }
+static inline atomic_val_t atomic_dec(atomic_t *t) { return atomic_add(t, -1); }
+static inline atomic_val_t atomic_or(atomic_t *t, atomic_val_t v) { return __atomic_fetch_or(t, v, __ATOMIC_SEQ_CST); }
+static inline bool atomic_cas(atomic_t *t, atomic_val_t old, atomic_val_t v) {
+    return __atomic_compare_exchange_n(t, &old, v, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+}
+static inline void atomic_set_bit(atomic_t *t, int bit) { (void)atomic_or(t, 1L << bit); }
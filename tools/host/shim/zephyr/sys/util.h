@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * Modifications (c) 2025 NUOVOTAKA
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+// Host build shim: Zephyr utility macros
+
+#pragma once
+
+#define ARRAY_SIZE(a) (sizeof(a) / sizeof((a)[0]))
+#define MIN(a, b) (((a) < (b)) ? (a) : (b))
+#define MAX(a, b) (((a) > (b)) ? (a) : (b))
+#define BIT(n) (1UL << (n))
+#define ARG_UNUSED(x) (void)(x)
+#define likely(x)   __builtin_expect(!!(x), 1)
+#define unlikely(x) __builtin_expect(!!(x), 0)
+#define ROUND_UP(x, a) ((((x) + ((a) - 1)) / (a)) * (a))
+#define CONTAINER_OF(ptr, type, field) ((type *)(((char *)(ptr)) - offsetof(type, field)))
+
+// IS_ENABLED / COND_CODE_1 / IF_ENABLED (same technique as Zephyr)
+// The extra level expands the config symbol before it is pasted
+#define Z_IS_ENABLED_1 0,
+#define IS_ENABLED(x) Z_IS_ENABLED0(x)
+#define Z_IS_ENABLED0(x) Z_IS_ENABLED1(Z_IS_ENABLED_##x)
+#define Z_IS_ENABLED1(v) Z_IS_ENABLED2(v 1, 0)
+#define Z_IS_ENABLED2(ignore, val, ...) val
+
+#define Z_COND_1 _,
+#define COND_CODE_1(flag, if_1, else_code) Z_COND_CODE_1(flag, if_1, else_code)
+#define Z_COND_CODE_1(flag, if_1, else_code) Z_COND_CODE(Z_COND_##flag, if_1, else_code)
+#define Z_COND_CODE(one_or_two_args, a, b) Z_GET_ARG2_DEBRACKET(one_or_two_args a, b)
+#define Z_GET_ARG2_DEBRACKET(ignore, val, ...) Z_DEBRACKET val
+#define Z_DEBRACKET(...) __VA_ARGS__
+#define IF_ENABLED(flag, code) COND_CODE_1(flag, code, ())
@@ -0,0 +1,14 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * Modifications (c) 2025 NUOVOTAKA
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+static inline void sys_trace_named_event(const char *name, uint32_t arg0, uint32_t arg1) {
+    (void)name; (void)arg0; (void)arg1;
+}
@@ -0,0 +1,44 @@
+// zephyr_shim.c - Host build shim: simulated clock, memory slabs
+//
+// Copyright (c) 2024 The ZMK Contributors
+// Modifications (c) 2025 NUOVOTAKA
+// SPDX-License-Identifier: MIT
+
+#include <zephyr/kernel.h>
+
+static uint64_t host_clock_us;
+
+void host_clock_set_us(uint64_t us) {
+    host_clock_us = us;
+}
+
+uint64_t host_clock_get_us(void) {
+    return host_clock_us;
+}
+
+int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t t) {
+    (void)t;
+    if (!slab->ready) {
+        // Thread the blocks on first use, like the kernel does at init
+        for (uint32_t i = 0; i < slab->num_blocks; i++) {
+            void *block = slab->buffer + (size_t)i * slab->block_size;
+            *(void **)block = slab->free_list;
+            slab->free_list = block;
+        }
+        slab->ready = true;
+    }
+    if (!slab->free_list) {
+        *mem = NULL;
+        return -ENOMEM;
+    }
+    *mem = slab->free_list;
+    slab->free_list = *(void **)slab->free_list;
+    slab->num_used++;
+    return 0;
+}
+
+void k_mem_slab_free(struct k_mem_slab *slab, void *mem) {
+    *(void **)mem = slab->free_list;
+    slab->free_list = mem;
+    slab->num_used--;
+}
@@ -0,0 +1,312 @@
+// trajectory.c - Synthetic pointer trajectory generator (host tools)
+// Hand motion is modelled in inches as a sequence of minimum-jerk segments
+// (or a closed-form path), then quantized to sensor counts per report
+//
+// Copyright (c) 2024 The ZMK Contributors
+// Modifications (c) 2025 NUOVOTAKA
+// SPDX-License-Identifier: MIT
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "trajectory.h"
+
+#define TRAJ_PI 3.14159265358979323846
+
+// Fitts' law MT = a + b * log2(2A / W), seconds (typical mouse pointing values)
+#define TRAJ_FITTS_A     0.05
+#define TRAJ_FITTS_B     0.12
+#define TRAJ_FITTS_WIDTH 0.15      // Target width, inches
+
+#define TRAJ_CIRCLE_RADIUS 0.75    // Inches
+#define TRAJ_CIRCLE_PERIOD 1.2     // Seconds per revolution
+
+#define TRAJ_JITTER_SIGMA 0.30     // Positional noise at rest, counts (1 sigma)
+
+static const char *const traj_kind_names[TRAJ_KIND_COUNT] = {
+    [TRAJ_FLICK] = "flick",
+    [TRAJ_DRAG] = "drag",
+    [TRAJ_CIRCLE] = "circle",
+    [TRAJ_JITTER] = "jitter",
+    [TRAJ_SCROLL] = "scroll",
+};
+
+// =============================================================================
+// RANDOM NUMBERS (splitmix64: identical on every platform)
+// =============================================================================
+
+struct traj_rng {
+    uint64_t state;
+};
+
+static uint64_t traj_rng_next(struct traj_rng *rng) {
+    uint64_t z = (rng->state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+static double traj_uniform(struct traj_rng *rng, double lo, double hi) {
+    double unit = (double)(traj_rng_next(rng) >> 11) * (1.0 / 9007199254740992.0);
+    return lo + (hi - lo) * unit;
+}
+
+// Standard normal sample (Box-Muller)
+static double traj_gauss(struct traj_rng *rng) {
+    double u1 = traj_uniform(rng, 1e-12, 1.0);
+    double u2 = traj_uniform(rng, 0.0, 1.0);
+    return sqrt(-2.0 * log(u1)) * cos(2.0 * TRAJ_PI * u2);
+}
+
+// =============================================================================
+// MOTION MODEL
+// =============================================================================
+
+// One movement: rest at (x0, y0) until t0, minimum-jerk move by (dx, dy) until t1
+struct traj_segment {
+    double t0;
+    double t1;
+    double x0;
+    double y0;
+    double dx;
+    double dy;
+};
+
+struct traj_state {
+    const struct traj_params *params;
+    struct traj_rng rng;
+    struct traj_segment seg;
+    double heading;                // Drag direction, radians
+    double target_x;               // Flick target (corrective submovement)
+    double target_y;
+    int correction;                // Corrective submovement pending
+    double next_detent;            // Scroll: time of the next wheel detent
+    int detents_left;              // Scroll: detents left in the burst
+    int wheel_dir;
+    int32_t wheel;                 // Scroll: detents so far
+};
+
+static double traj_min_jerk(double tau) {
+    return tau * tau * tau * (10.0 + tau * (-15.0 + 6.0 * tau));
+}
+
+static void traj_segment_position(const struct traj_segment *seg, double t, double *x, double *y) {
+    double s = 1.0;
+    if (t <= seg->t0) {
+        s = 0.0;
+    } else if (t < seg->t1) {
+        s = traj_min_jerk((t - seg->t0) / (seg->t1 - seg->t0));
+    }
+    *x = seg->x0 + seg->dx * s;
+    *y = seg->y0 + seg->dy * s;
+}
+
+// Plan the movement that follows the current one
+static void traj_plan_segment(struct traj_state *st) {
+    struct traj_segment *seg = &st->seg;
+    struct traj_rng *rng = &st->rng;
+    double x = seg->x0 + seg->dx;
+    double y = seg->y0 + seg->dy;
+    double gap;
+    double duration;
+    double dx;
+    double dy;
+
+    if (st->params->kind == TRAJ_FLICK) {
+        if (st->correction) {
+            // Short corrective submovement onto the target
+            dx = st->target_x - x;
+            dy = st->target_y - y;
+            gap = traj_uniform(rng, 0.02, 0.05);
+            duration = traj_uniform(rng, 0.12, 0.20);
+            st->correction = 0;
+        } else {
+            // Aimed movement: primary submovement lands near the target
+            double amplitude = traj_uniform(rng, 1.0, 6.0);
+            double angle = traj_uniform(rng, 0.0, 2.0 * TRAJ_PI);
+            double reach = amplitude * traj_uniform(rng, 0.90, 1.05);
+            st->target_x = x + amplitude * cos(angle);
+            st->target_y = y + amplitude * sin(angle);
+            dx = reach * cos(angle);
+            dy = reach * sin(angle);
+            gap = traj_uniform(rng, 0.15, 0.50);
+            duration = TRAJ_FITTS_A + TRAJ_FITTS_B * log2(2.0 * amplitude / TRAJ_FITTS_WIDTH);
+            st->correction = 1;
+        }
+    } else {
+        // TRAJ_DRAG: short slow strokes with a wandering heading
+        double length = traj_uniform(rng, 0.05, 0.40);
+        double speed = traj_uniform(rng, 0.2, 0.5); // Mean speed, inches/s
+        st->heading += traj_uniform(rng, -0.5, 0.5);
+        dx = length * cos(st->heading);
+        dy = length * sin(st->heading);
+        gap = traj_uniform(rng, 0.05, 0.20);
+        duration = length / speed;
+    }
+
+    seg->t0 = seg->t1 + gap;
+    seg->t1 = seg->t0 + duration;
+    seg->x0 = x;
+    seg->y0 = y;
+    seg->dx = dx;
+    seg->dy = dy;
+}
+
+// Ideal position in inches at time t (motion kinds)
+static void traj_position(struct traj_state *st, double t, double *x, double *y) {
+    switch (st->params->kind) {
+    case TRAJ_CIRCLE: {
+        double phase = 2.0 * TRAJ_PI * t / TRAJ_CIRCLE_PERIOD;
+        *x = TRAJ_CIRCLE_RADIUS * (cos(phase) - 1.0);
+        *y = TRAJ_CIRCLE_RADIUS * sin(phase);
+        break;
+    }
+    case TRAJ_FLICK:
+    case TRAJ_DRAG:
+        while (t >= st->seg.t1) {
+            traj_plan_segment(st);
+        }
+        traj_segment_position(&st->seg, t, x, y);
+        break;
+    default: // TRAJ_JITTER: the hand rests
+        *x = 0.0;
+        *y = 0.0;
+        break;
+    }
+}
+
+// Wheel detents due by time t
+static int32_t traj_wheel_position(struct traj_state *st, double t) {
+    struct traj_rng *rng = &st->rng;
+
+    while (t >= st->next_detent) {
+        if (st->detents_left == 0) {
+            // New burst after a pause
+            st->detents_left = (int)traj_uniform(rng, 3.0, 13.0);
+            st->wheel_dir = (traj_rng_next(rng) & 1) ? 1 : -1;
+            st->next_detent += traj_uniform(rng, 0.3, 0.9);
+            continue;
+        }
+        st->wheel += st->wheel_dir;
+        st->detents_left--;
+        st->next_detent += traj_uniform(rng, 0.025, 0.060);
+    }
+    return st->wheel;
+}
+
+// =============================================================================
+// STREAM
+// =============================================================================
+
+static int traj_push(struct traj_stream *stream, uint32_t time_us, uint16_t code, int32_t value,
+                     uint8_t sync, double ideal) {
+    if (stream->count == stream->capacity) {
+        size_t capacity = stream->capacity ? stream->capacity * 2 : 1024;
+        struct traj_event *events = realloc(stream->events, capacity * sizeof(*events));
+        if (!events) {
+            return -1;
+        }
+        stream->events = events;
+        stream->capacity = capacity;
+    }
+
+    value = (value > INT16_MAX) ? INT16_MAX : (value < INT16_MIN) ? INT16_MIN : value;
+    stream->events[stream->count++] = (struct traj_event){
+        .time_us = time_us,
+        .code = code,
+        .value = (int16_t)value,
+        .sync = sync,
+        .ideal = ideal,
+    };
+    return 0;
+}
+
+int traj_generate(const struct traj_params *params, struct traj_stream *stream) {
+    if (!params || !stream || params->kind >= TRAJ_KIND_COUNT ||
+        params->rate_hz == 0 || params->rate_hz > 100000 ||
+        params->dpi == 0 || params->dpi > 100000 || params->duration_ms == 0) {
+        return -1;
+    }
+
+    memset(stream, 0, sizeof(*stream));
+    struct traj_state st = {
+        .params = params,
+        .rng = {.state = params->seed},
+    };
+
+    uint64_t reports = (uint64_t)params->duration_ms * params->rate_hz / 1000;
+    int64_t emitted_x = 0;
+    int64_t emitted_y = 0;
+
+    for (uint64_t k = 0; k < reports; k++) {
+        uint32_t time_us = (uint32_t)(k * 1000000ULL / params->rate_hz);
+        double t = (double)time_us / 1e6;
+        int ret = 0;
+
+        if (params->kind == TRAJ_SCROLL) {
+            int32_t wheel = traj_wheel_position(&st, t);
+            if (wheel != emitted_x) {
+                ret = traj_push(stream, time_us, TRAJ_REL_WHEEL, (int32_t)(wheel - emitted_x), 1,
+                                wheel);
+                emitted_x = wheel;
+            }
+        } else {
+            double x;
+            double y;
+            traj_position(&st, t, &x, &y);
+            double ideal_x = x * params->dpi;
+            double ideal_y = y * params->dpi;
+
+            // The sensor counts edges: measured position rounded to whole counts
+            double measured_x = ideal_x;
+            double measured_y = ideal_y;
+            if (params->kind == TRAJ_JITTER) {
+                measured_x += TRAJ_JITTER_SIGMA * traj_gauss(&st.rng);
+                measured_y += TRAJ_JITTER_SIGMA * traj_gauss(&st.rng);
+            }
+            int64_t dx = llround(measured_x) - emitted_x;
+            int64_t dy = llround(measured_y) - emitted_y;
+
+            // Idle reports are not sent; a moving report carries both axes
+            if (dx != 0 || dy != 0) {
+                dx = (dx > INT16_MAX) ? INT16_MAX : (dx < INT16_MIN) ? INT16_MIN : dx;
+                dy = (dy > INT16_MAX) ? INT16_MAX : (dy < INT16_MIN) ? INT16_MIN : dy;
+                ret = traj_push(stream, time_us, TRAJ_REL_X, (int32_t)dx, 0, ideal_x);
+                if (ret == 0) {
+                    ret = traj_push(stream, time_us, TRAJ_REL_Y, (int32_t)dy, 1, ideal_y);
+                }
+                emitted_x += dx;
+                emitted_y += dy;
+            }
+        }
+
+        if (ret < 0) {
+            traj_free(stream);
+            return -1;
+        }
+    }
+
+    stream->reports = (uint32_t)reports;
+    return 0;
+}
+
+void traj_free(struct traj_stream *stream) {
+    if (!stream) {
+        return;
+    }
+    free(stream->events);
+    memset(stream, 0, sizeof(*stream));
+}
+
+const char *traj_kind_name(enum traj_kind kind) {
+    return (kind < TRAJ_KIND_COUNT) ? traj_kind_names[kind] : "unknown";
+}
+
+enum traj_kind traj_kind_parse(const char *name) {
+    for (int kind = 0; name && kind < TRAJ_KIND_COUNT; kind++) {
+        if (strcmp(name, traj_kind_names[kind]) == 0) {
+            return (enum traj_kind)kind;
+        }
+    }
+    return TRAJ_KIND_COUNT;
+}
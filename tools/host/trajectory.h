@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * Modifications (c) 2025 NUOVOTAKA
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+// Synthetic pointer trajectory generator (host tools)
+// Seeded, deterministic REL event streams for benchmarks and tuning
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Event codes (same values as Zephyr's INPUT_REL_*)
+#define TRAJ_REL_X      0x00
+#define TRAJ_REL_Y      0x01
+#define TRAJ_REL_HWHEEL 0x06
+#define TRAJ_REL_WHEEL  0x08
+
+enum traj_kind {
+    TRAJ_FLICK,                    // Fitts-style aimed movements with minimum-jerk velocity
+    TRAJ_DRAG,                     // Slow precision drags with small corrections
+    TRAJ_CIRCLE,                   // Constant-speed circles
+    TRAJ_JITTER,                   // Sensor noise while the hand rests
+    TRAJ_SCROLL,                   // Wheel detent bursts
+    TRAJ_KIND_COUNT,
+};
+
+struct traj_params {
+    enum traj_kind kind;
+    uint32_t rate_hz;              // Sensor report rate (125..8000)
+    uint32_t dpi;                  // Sensor resolution, counts per inch
+    uint32_t duration_ms;          // Stream length
+    uint64_t seed;                 // Same seed, same stream on every machine
+};
+
+struct traj_event {
+    uint32_t time_us;              // Report time since stream start
+    uint16_t code;                 // TRAJ_REL_*
+    int16_t value;                 // Counts (or detents for wheels)
+    uint8_t sync;                  // Last event of the report
+    double ideal;                  // Ideal cumulative position on this axis (counts)
+};
+
+struct traj_stream {
+    struct traj_event *events;
+    size_t count;
+    size_t capacity;
+    uint32_t reports;              // Report slots in the stream (including idle ones)
+};
+
+/**
+ * @brief Fill the stream for the given parameters
+ * Motion is modelled in inches and sampled at the report rate; fractional
+ * counts are carried between reports like a sensor's accumulator, so the
+ * summed output matches the ideal path to within one count.
+ * @return 0 on success, -1 on invalid parameters or allocation failure
+ */
+int traj_generate(const struct traj_params *params, struct traj_stream *stream);
+
+void traj_free(struct traj_stream *stream);
+
+const char *traj_kind_name(enum traj_kind kind);
+
+/**
+ * @brief Look up a kind by name
+ * @return Kind, or TRAJ_KIND_COUNT if unknown
+ */
+enum traj_kind traj_kind_parse(const char *name);
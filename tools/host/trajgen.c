@@ -0,0 +1,45 @@
+// trajgen.c - Dump a synthetic trajectory as CSV
+// Usage: trajgen <flick|drag|circle|jitter|scroll> [rate_hz] [dpi] [duration_ms] [seed]
+//
+// Copyright (c) 2024 The ZMK Contributors
+// Modifications (c) 2025 NUOVOTAKA
+// SPDX-License-Identifier: MIT
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "trajectory.h"
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <kind> [rate_hz] [dpi] [duration_ms] [seed]\n", argv[0]);
+        fprintf(stderr, "kinds:");
+        for (int kind = 0; kind < TRAJ_KIND_COUNT; kind++) {
+            fprintf(stderr, " %s", traj_kind_name((enum traj_kind)kind));
+        }
+        fprintf(stderr, "\n");
+        return 2;
+    }
+
+    struct traj_params params = {
+        .kind = traj_kind_parse(argv[1]),
+        .rate_hz = (argc > 2) ? (uint32_t)strtoul(argv[2], NULL, 0) : 1000,
+        .dpi = (argc > 3) ? (uint32_t)strtoul(argv[3], NULL, 0) : 800,
+        .duration_ms = (argc > 4) ? (uint32_t)strtoul(argv[4], NULL, 0) : 5000,
+        .seed = (argc > 5) ? strtoull(argv[5], NULL, 0) : 1,
+    };
+
+    struct traj_stream stream;
+    if (traj_generate(&params, &stream) < 0) {
+        fprintf(stderr, "invalid parameters\n");
+        return 1;
+    }
+
+    printf("time_us,code,value,sync,ideal\n");
+    for (size_t i = 0; i < stream.count; i++) {
+        const struct traj_event *ev = &stream.events[i];
+        printf("%u,%u,%d,%u,%.3f\n", ev->time_us, ev->code, ev->value, ev->sync, ev->ideal);
+    }
+
+    traj_free(&stream);
+    return 0;
+}
@@ -0,0 +1,266 @@
+// xycheck.c - Equivalence of the dual-axis frame API and the per-axis path
+// Runs every X/Y pair of a report through accel_calculate_xy() and through
+// the level calculation for X then Y, and compares outputs and speed state.
+// Also checks the packed kernel against the truncating divide on every lane,
+// and accel_pipeline_run_xy() against the chain for X then Y on trajectories.
+//
+// Usage: xycheck [speed_step (1 = every speed state)]
+//
+// Copyright (c) 2024 The ZMK Contributors
+// Modifications (c) 2025 NUOVOTAKA
+// SPDX-License-Identifier: MIT
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "accel_host.h"
+#include "trajectory.h"
+#include "../../src/config/accel_config_adapter.h"
+
+// Inputs around the packed range, so the switch to the scalar path is covered
+#define XY_INPUT_LIMIT (MAX_REASONABLE_INPUT + 50)
+
+// Speed states the EMA can hold without being reset as corrupt
+#define XY_SPEED_STATES (ACCEL_SPEED_LIMIT / 2 + 1)
+
+// Host clock while checking (milliseconds since the host time origin)
+#define XY_NOW_MS 10000U
+
+struct xy_result {
+    uint64_t evaluated;
+    uint64_t mismatches;
+    char example[120];
+};
+
+static uint32_t xy_speed_step = 1024;
+
+// Per-axis reference: the level calculation for X then Y, zero axes skipped
+static void xy_scalar(const struct accel_config *cfg, struct accel_data *data, int32_t *x,
+                      int32_t *y) {
+    int32_t *axes[2] = {x, y};
+    static const uint16_t codes[2] = {INPUT_REL_X, INPUT_REL_Y};
+
+    for (int axis = 0; axis < 2; axis++) {
+        if (*axes[axis] == 0) {
+            continue;
+        }
+        *axes[axis] = (cfg->level == 1) ? accel_simple_calculate(cfg, *axes[axis], codes[axis])
+                                        : accel_standard_calculate(cfg, data, *axes[axis], codes[axis]);
+    }
+}
+
+static void xy_compare(struct xy_result *r, const struct accel_config *cfg,
+                       const struct accel_data *state, int32_t x, int32_t y) {
+    struct accel_data packed = *state;
+    struct accel_data scalar = *state;
+    int32_t px = x, py = y, sx = x, sy = y;
+
+    accel_calculate_xy(cfg, &packed, &px, &py);
+    xy_scalar(cfg, &scalar, &sx, &sy);
+
+    r->evaluated++;
+    if (px == sx && py == sy && packed.recent_speed == scalar.recent_speed &&
+        packed.last_time_ms == scalar.last_time_ms) {
+        return;
+    }
+    if (r->mismatches++ == 0) {
+        snprintf(r->example, sizeof(r->example),
+                 "in (%d,%d) speed state %u: xy (%d,%d) speed %u, scalar (%d,%d) speed %u", x, y,
+                 (unsigned)state->recent_speed, px, py, (unsigned)packed.recent_speed, sx, sy,
+                 (unsigned)scalar.recent_speed);
+    }
+}
+
+/**
+ * Every X/Y pair; Level 2 also every speed state (step xy_speed_step) after
+ * 1 ms and after a pause, the two cases that bound the speed sample.
+ */
+static void xy_run(const struct accel_config *cfg, struct xy_result *r) {
+    static const uint32_t elapsed_ms[] = {1, SPEED_CALC_TIME_LIMIT_MS};
+    struct accel_data state;
+    memset(&state, 0, sizeof(state));
+
+    uint32_t time_classes = (cfg->level == 2) ? ARRAY_SIZE(elapsed_ms) : 1;
+    uint32_t speeds = (cfg->level == 2) ? XY_SPEED_STATES : 1;
+
+    for (uint32_t tc = 0; tc < time_classes; tc++) {
+        for (uint32_t speed = 0; speed < speeds; speed += xy_speed_step) {
+            state.recent_speed = (accel_speed_t)speed;
+            state.last_time_ms = ACCEL_HOST_TIME_ORIGIN_US / 1000 + XY_NOW_MS - elapsed_ms[tc];
+            for (int32_t x = -XY_INPUT_LIMIT; x <= XY_INPUT_LIMIT; x++) {
+                for (int32_t y = -XY_INPUT_LIMIT; y <= XY_INPUT_LIMIT; y++) {
+                    xy_compare(r, cfg, &state, x, y);
+                }
+            }
+        }
+    }
+}
+
+// accel_xy_scale() against lane * gain / 1000 (truncated, int16-saturated)
+// on every int16 lane, for gains 0..INT16_MAX in steps of 97 plus the top
+static int xy_check_kernel(void) {
+    uint64_t evaluated = 0;
+    uint64_t mismatches = 0;
+
+    for (int32_t g = 0; g <= INT16_MAX; g = (g == INT16_MAX) ? g + 1 : MIN(g + 97, INT16_MAX)) {
+        int32_t gain = accel_xy_gain((uint16_t)g);
+        for (int32_t lane = INT16_MIN; lane <= INT16_MAX; lane++) {
+            int16_t other = (int16_t)(INT16_MAX - (lane - INT16_MIN));
+            accel_xy_t out = accel_xy_scale(accel_xy_pack((int16_t)lane, other), gain, gain);
+            int32_t ex = ACCEL_CLAMP(lane * g / SENSITIVITY_SCALE, INT16_MIN, INT16_MAX);
+            int32_t ey = ACCEL_CLAMP(other * g / SENSITIVITY_SCALE, INT16_MIN, INT16_MAX);
+            evaluated += 2;
+            if (accel_xy_get_x(out) != ex || accel_xy_get_y(out) != ey) {
+                if (mismatches++ == 0) {
+                    printf("   first: gain %d, lanes (%d,%d): (%d,%d), expected (%d,%d)\n", g, lane,
+                           other, accel_xy_get_x(out), accel_xy_get_y(out), ex, ey);
+                }
+            }
+        }
+    }
+    printf("%-2s %-32s %12llu %10llu\n", "-", "kernel lanes", (unsigned long long)evaluated,
+           (unsigned long long)mismatches);
+    return mismatches ? 1 : 0;
+}
+
+// accel_pipeline_run_xy() for each report with non-zero X and Y, against a
+// second instance running accel_pipeline_run() for X then Y
+static int xy_check_pipeline(uint8_t level, const char *preset) {
+    static struct accel_host packed;
+    static struct accel_host chain;
+    uint64_t pairs = 0;
+    uint64_t mismatches = 0;
+
+    accel_host_set_time_us(0);
+    if (accel_host_init(&packed, level, preset) < 0 || accel_host_init(&chain, level, preset) < 0) {
+        return 0;
+    }
+
+    for (int kind = 0; kind < TRAJ_KIND_COUNT; kind++) {
+        struct traj_params params = {
+            .kind = (enum traj_kind)kind,
+            .rate_hz = 1000,
+            .dpi = packed.cfg.sensor_dpi,
+            .duration_ms = 2000,
+            .seed = 1,
+        };
+        struct traj_stream stream;
+
+        if (traj_generate(&params, &stream) < 0) {
+            printf("   %s: trajectory generation failed\n", traj_kind_name(params.kind));
+            mismatches++;
+            continue;
+        }
+        for (size_t i = 0; i < stream.count; i++) {
+            const struct traj_event *ev = &stream.events[i];
+            const struct traj_event *next = (i + 1 < stream.count) ? ev + 1 : NULL;
+            accel_host_set_time_us((uint64_t)kind * 10000000ULL + ev->time_us);
+
+            int32_t x = ev->value;
+            int32_t y = next ? next->value : 0;
+            if (next && ev->code == INPUT_REL_X && !ev->sync && next->code == INPUT_REL_Y &&
+                next->time_us == ev->time_us &&
+                accel_pipeline_run_xy(&packed.cfg, &packed.data, &x, &y, next->sync)) {
+                int32_t ex = accel_pipeline_run(&chain.cfg, &chain.data, ev->code, ev->value, false);
+                int32_t ey = accel_pipeline_run(&chain.cfg, &chain.data, next->code, next->value,
+                                                next->sync);
+                pairs++;
+                i++;
+                if ((x != ex || y != ey) && mismatches++ == 0) {
+                    printf("   %s event %zu (in %d,%d): xy (%d,%d), chain (%d,%d)\n",
+                           traj_kind_name(params.kind), i, ev->value, next->value, x, y, ex, ey);
+                }
+                continue;
+            }
+            int32_t out = accel_host_process(&packed, ev->code, ev->value, ev->sync);
+            if (out != accel_host_process(&chain, ev->code, ev->value, ev->sync) &&
+                mismatches++ == 0) {
+                printf("   %s event %zu: outputs differ after the pairs\n",
+                       traj_kind_name(params.kind), i);
+            }
+        }
+        traj_free(&stream);
+    }
+
+    printf("%-2u %-32s %12llu %10llu\n", level, preset ? preset : "defaults",
+           (unsigned long long)pairs, (unsigned long long)mismatches);
+    return mismatches ? 1 : 0;
+}
+
+static int xy_check(const struct accel_host *host, const char *name) {
+    struct xy_result r;
+    memset(&r, 0, sizeof(r));
+
+    struct accel_config cfg = host->cfg;
+    cfg.log = NULL;
+    xy_run(&cfg, &r);
+
+    printf("%-2u %-32s %12llu %10llu\n", cfg.level, name, (unsigned long long)r.evaluated,
+           (unsigned long long)r.mismatches);
+    if (r.mismatches) {
+        printf("   first: %s\n", r.example);
+    }
+    return r.mismatches ? 1 : 0;
+}
+
+int main(int argc, char **argv) {
+    static const struct {
+        uint16_t sensitivity;
+        uint16_t dpi;
+    } gain_corners[] = {{200, 8000}, {2000, 400}};
+    static const uint16_t y_boosts[] = {500, 3000};
+    struct accel_host host;
+    char name[48];
+    int failed = 0;
+
+    if (argc > 1) {
+        xy_speed_step = (uint32_t)strtoul(argv[1], NULL, 0);
+        xy_speed_step = xy_speed_step ? xy_speed_step : 1;
+    }
+    accel_host_set_time_us((uint64_t)XY_NOW_MS * 1000);
+
+    printf("xycheck: input -%d..%d on both axes, speed states 0..%u step %u\n", XY_INPUT_LIMIT,
+           XY_INPUT_LIMIT, XY_SPEED_STATES - 1, xy_speed_step);
+    printf("%-2s %-32s %12s %10s\n", "L", "config", "evaluated", "mismatch");
+
+    for (uint8_t level = 1; level <= 2; level++) {
+        for (int p = 0; p < ACCEL_HOST_PRESET_COUNT; p++) {
+            if (accel_host_init(&host, level, accel_host_presets[p]) == 0) {
+                failed |= xy_check(&host, accel_host_presets[p]);
+            }
+        }
+        for (size_t g = 0; g < ARRAY_SIZE(gain_corners); g++) {
+            accel_host_init(&host, level, NULL);
+            if (level == 1) {
+                host.cfg.cfg.level1.sensitivity = gain_corners[g].sensitivity;
+            } else {
+                host.cfg.cfg.level2.sensitivity = gain_corners[g].sensitivity;
+            }
+            accel_set_sensor_dpi(&host.cfg, gain_corners[g].dpi);
+            snprintf(name, sizeof(name), "s%u/%u", gain_corners[g].sensitivity,
+                     gain_corners[g].dpi);
+            failed |= xy_check(&host, name);
+        }
+    }
+    for (size_t b = 0; b < ARRAY_SIZE(y_boosts); b++) {
+        accel_host_init(&host, 2, NULL);
+        accel_set_y_boost(&host.cfg, y_boosts[b]);
+        snprintf(name, sizeof(name), "y%u", y_boosts[b]);
+        failed |= xy_check(&host, name);
+    }
+
+
+    printf("\n%-2s %-32s %12s %10s\n", "L", "pipeline pairs", "pairs", "mismatch");
+    for (uint8_t level = 1; level <= 2; level++) {
+        failed |= xy_check_pipeline(level, NULL);
+        for (int p = 0; p < ACCEL_HOST_PRESET_COUNT; p++) {
+            failed |= xy_check_pipeline(level, accel_host_presets[p]);
+        }
+    }
+
+    printf("\n");
+    failed |= xy_check_kernel();
+
+    printf("\n%s\n", failed ? "MISMATCH" : "xy and per-axis results identical");
+    return failed;
+}